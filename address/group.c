@@ -72,7 +72,7 @@ static struct Group *group_new(const char *pat)
   struct Group *g = mutt_mem_calloc(1, sizeof(struct Group));
 
   g->name = mutt_str_dup(pat);
-  STAILQ_INIT(&g->rs);
+  STAILQ_INIT(&g->rs.head);
   TAILQ_INIT(&g->al);
 
   return g;
@@ -171,7 +171,7 @@ static bool empty_group(struct Group *g)
 {
   if (!g)
     return true;
-  return TAILQ_EMPTY(&g->al) && STAILQ_EMPTY(&g->rs);
+  return TAILQ_EMPTY(&g->al) && STAILQ_EMPTY(&g->rs.head);
 }
 
 /**
@@ -61,6 +61,12 @@
 
 struct AliasList Aliases = TAILQ_HEAD_INITIALIZER(Aliases); ///< List of all the user's email aliases
 
+ARRAY_HEAD(AliasNameArray, struct Alias *);
+
+static struct HashTable *AliasNames = NULL; ///< Hash Table of aliases (name -> alias)
+static struct AliasNameArray AliasNamesSorted = ARRAY_HEAD_INITIALIZER; ///< Aliases sorted by name, for completion
+static bool AliasNamesSortedValid = false; ///< Does #AliasNamesSorted match #Aliases?
+
 /**
  * write_safe_address - Defang malicious email addresses
  * @param fp File to write to
@@ -276,14 +282,132 @@ static bool string_is_address(const char *str, const char *user, const char *dom
  */
 struct AddressList *alias_lookup(const char *name)
 {
-  struct Alias *a = NULL;
+  struct Alias *a = alias_index_find(name);
+  return a ? &a->addr : NULL;
+}
+
+/**
+ * alias_index_add - Add an Alias to the name index
+ * @param alias Alias to add
+ */
+void alias_index_add(struct Alias *alias)
+{
+  if (!alias || !alias->name || !AliasNames)
+    return;
+
+  mutt_hash_insert(AliasNames, alias->name, alias);
+  AliasNamesSortedValid = false;
+}
+
+/**
+ * alias_index_delete - Remove an Alias from the name index
+ * @param alias Alias to remove
+ */
+void alias_index_delete(struct Alias *alias)
+{
+  if (!alias || !alias->name || !AliasNames)
+    return;
+
+  mutt_hash_delete(AliasNames, alias->name, alias);
+  AliasNamesSortedValid = false;
+}
+
+/**
+ * alias_index_find - Find an Alias by name
+ * @param name Alias name to find
+ * @retval ptr  Matching Alias
+ * @retval NULL No such Alias
+ *
+ * @note The search is case-insensitive
+ */
+struct Alias *alias_index_find(const char *name)
+{
+  return mutt_hash_find(AliasNames, name);
+}
+
+/**
+ * alias_sort_by_name - Compare two Aliases by name - Implements ::sort_t - @ingroup sort_api
+ */
+static int alias_sort_by_name(const void *a, const void *b, void *sdata)
+{
+  const struct Alias *alias_a = *(struct Alias const *const *) a;
+  const struct Alias *alias_b = *(struct Alias const *const *) b;
+
+  return mutt_str_cmp(alias_a->name, alias_b->name);
+}
+
+/**
+ * alias_prefix_bound - Find the edge of a range of Aliases with a prefix
+ * @param prefix Prefix to match
+ * @param len    Length of prefix
+ * @param upper  If true, find the end of the range, else the start
+ * @retval num Index into #AliasNamesSorted
+ */
+static size_t alias_prefix_bound(const char *prefix, size_t len, bool upper)
+{
+  size_t lo = 0;
+  size_t hi = ARRAY_SIZE(&AliasNamesSorted);
 
-  TAILQ_FOREACH(a, &Aliases, entries)
+  while (lo < hi)
   {
-    if (mutt_istr_equal(name, a->name))
-      return &a->addr;
+    size_t mid = lo + ((hi - lo) / 2);
+    struct Alias *a = *ARRAY_GET(&AliasNamesSorted, mid);
+    int rc = strncmp(NONULL(a->name), prefix, len);
+    if ((rc < 0) || (upper && (rc == 0)))
+      lo = mid + 1;
+    else
+      hi = mid;
   }
-  return NULL;
+
+  return lo;
+}
+
+/**
+ * alias_index_complete - Find the longest completion of an Alias name
+ * @param prefix  Start of an Alias name
+ * @param best    Buffer for the result
+ * @param bestlen Length of buffer
+ * @retval true  At least one Alias starts with the prefix
+ * @retval false No Alias matches
+ *
+ * The result is the longest string that all the matching Alias names start with.
+ *
+ * @note The match is case-sensitive
+ */
+bool alias_index_complete(const char *prefix, char *best, size_t bestlen)
+{
+  if (!prefix || !best || (bestlen == 0))
+    return false;
+
+  if (!AliasNamesSortedValid)
+  {
+    ARRAY_SHRINK(&AliasNamesSorted, ARRAY_SIZE(&AliasNamesSorted));
+    struct Alias *np = NULL;
+    TAILQ_FOREACH(np, &Aliases, entries)
+    {
+      if (np->name)
+        ARRAY_ADD(&AliasNamesSorted, np);
+    }
+    ARRAY_SORT(&AliasNamesSorted, alias_sort_by_name, NULL);
+    AliasNamesSortedValid = true;
+  }
+
+  const size_t len = mutt_str_len(prefix);
+  const size_t first = alias_prefix_bound(prefix, len, false);
+  const size_t last = alias_prefix_bound(prefix, len, true);
+  if (first >= last)
+    return false;
+
+  // The names are sorted, so the first and last share the common prefix
+  const char *name_first = (*ARRAY_GET(&AliasNamesSorted, first))->name;
+  const char *name_last = (*ARRAY_GET(&AliasNamesSorted, last - 1))->name;
+
+  size_t i;
+  for (i = 0; name_first[i] && (name_first[i] == name_last[i]) && (i < (bestlen - 1)); i++)
+    best[i] = name_first[i];
+
+  best[i] = '\0';
+  return true;
 }
 
 /**
@@ -509,6 +633,7 @@ retry_name:
   }
 
   alias_reverse_add(alias);
+  alias_index_add(alias);
   TAILQ_INSERT_TAIL(&Aliases, alias, entries);
 
   const char *const c_alias_file = cs_subset_path(sub, "alias_file");
@@ -714,6 +839,7 @@ void aliaslist_clear(struct AliasList *al)
 void alias_init(void)
 {
   alias_reverse_init();
+  AliasNames = mutt_hash_new(1031, MUTT_HASH_STRCASECMP);
 }
 
 /**
@@ -721,11 +847,9 @@ void alias_init(void)
  */
 void alias_cleanup(void)
 {
-  struct Alias *np = NULL;
-  TAILQ_FOREACH(np, &Aliases, entries)
-  {
-    alias_reverse_delete(np);
-  }
   aliaslist_clear(&Aliases);
   alias_reverse_shutdown();
+  mutt_hash_free(&AliasNames);
+  ARRAY_FREE(&AliasNamesSorted);
+  AliasNamesSortedValid = false;
 }
@@ -72,4 +72,9 @@ struct Alias *alias_new (void);
 
 void          aliaslist_clear(struct AliasList *al);
 
+void          alias_index_add     (struct Alias *alias);
+bool          alias_index_complete(const char *prefix, char *best, size_t bestlen);
+void          alias_index_delete  (struct Alias *alias);
+struct Alias *alias_index_find    (const char *name);
+
 #endif /* MUTT_ALIAS_ALIAS_H */
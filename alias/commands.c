@@ -177,11 +177,7 @@ enum CommandResult parse_alias(struct Buffer *buf, struct Buffer *s,
   }
 
   /* check to see if an alias with this name already exists */
-  TAILQ_FOREACH(tmp, &Aliases, entries)
-  {
-    if (mutt_istr_equal(tmp->name, name))
-      break;
-  }
+  tmp = alias_index_find(name);
 
   if (tmp)
   {
@@ -198,6 +194,7 @@ enum CommandResult parse_alias(struct Buffer *buf, struct Buffer *s,
     tmp = alias_new();
     tmp->name = name;
     TAILQ_INSERT_TAIL(&Aliases, tmp, entries);
+    alias_index_add(tmp);
     event = NT_ALIAS_ADD;
   }
   tmp->addr = al;
@@ -261,21 +258,20 @@ enum CommandResult parse_unalias(struct Buffer *buf, struct Buffer *s,
       TAILQ_FOREACH(np, &Aliases, entries)
       {
         alias_reverse_delete(np);
+        alias_index_delete(np);
       }
 
       aliaslist_clear(&Aliases);
       return MUTT_CMD_SUCCESS;
     }
 
-    TAILQ_FOREACH(np, &Aliases, entries)
+    np = alias_index_find(buf->data);
+    if (np)
     {
-      if (!mutt_istr_equal(buf->data, np->name))
-        continue;
-
       TAILQ_REMOVE(&Aliases, np, entries);
       alias_reverse_delete(np);
+      alias_index_delete(np);
       alias_free(&np);
-      break;
     }
   } while (MoreArgs(s));
   return MUTT_CMD_SUCCESS;
@@ -450,25 +450,7 @@ int alias_complete(struct Buffer *buf, struct ConfigSubset *sub)
 
   if (buf_at(buf, 0) != '\0')
   {
-    TAILQ_FOREACH(np, &Aliases, entries)
-    {
-      if (np->name && mutt_strn_equal(np->name, buf_string(buf), buf_len(buf)))
-      {
-        if (bestname[0] == '\0') /* init */
-        {
-          mutt_str_copy(bestname, np->name,
-                        MIN(mutt_str_len(np->name) + 1, sizeof(bestname)));
-        }
-        else
-        {
-          int i;
-          for (i = 0; np->name[i] && (np->name[i] == bestname[i]); i++)
-            ; // do nothing
-
-          bestname[i] = '\0';
-        }
-      }
-    }
+    alias_index_complete(buf_string(buf), bestname, sizeof(bestname));
 
     if (bestname[0] == '\0')
     {
@@ -548,6 +530,7 @@ done:
       continue;
 
     TAILQ_REMOVE(&Aliases, avp->alias, entries);
+    alias_index_delete(avp->alias);
     alias_free(&avp->alias);
   }
 
@@ -607,6 +590,7 @@ done:
     if (avp->is_deleted)
     {
       TAILQ_REMOVE(&Aliases, avp->alias, entries);
+      alias_index_delete(avp->alias);
       alias_free(&avp->alias);
     }
   }
@@ -39,8 +39,8 @@
 #include "commands.h"
 #include "mview.h"
 
-static struct RegexList Alternates = STAILQ_HEAD_INITIALIZER(Alternates); ///< List of regexes to match the user's alternate email addresses
-static struct RegexList UnAlternates = STAILQ_HEAD_INITIALIZER(UnAlternates); ///< List of regexes to exclude false matches in Alternates
+static struct RegexList Alternates = REGEXLIST_INITIALIZER(Alternates); ///< List of regexes to match the user's alternate email addresses
+static struct RegexList UnAlternates = REGEXLIST_INITIALIZER(UnAlternates); ///< List of regexes to exclude false matches in Alternates
 static struct Notify *AlternatesNotify = NULL; ///< Notifications: #NotifyAlternates
 
 /**
@@ -28,12 +28,15 @@
  */
 
 #include "config.h"
+#include <ctype.h>
 #include <dirent.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <utime.h>
 #include "mutt/lib.h"
 #include "config/lib.h"
 #include "email/lib.h"
@@ -41,9 +44,22 @@
 #include "lib.h"
 #include "mutt_account.h"
 #include "muttlib.h"
+#include "sort.h"
 
 struct ConnAccount;
 
+/**
+ * struct BcacheEntry - A file in the Body Cache
+ */
+struct BcacheEntry
+{
+  char *path;  ///< Path of the file
+  off_t size;  ///< Size of the file
+  time_t used; ///< When the file was last used
+  bool dirty;  ///< The file's mtime needs updating from used
+};
+ARRAY_HEAD(BcacheEntryArray, struct BcacheEntry *);
+
 /**
  * struct BodyCache - Local cache of email bodies
  */
@@ -52,6 +68,326 @@ struct BodyCache
   char *path; ///< On-disk path to the file
 };
 
+/// Files in the Body Caches, only used with $message_cache_size
+static struct HashTable *BcacheIndex = NULL;
+/// Body Cache directories that have been added to #BcacheIndex
+static struct HashTable *BcacheIndexDirs = NULL;
+/// $message_cache_dir that #BcacheIndex describes
+static char *BcacheIndexDir = NULL;
+/// Total size of the files in #BcacheIndex
+static off_t BcacheSize = 0;
+
+/**
+ * bcache_entry_free - Free a Body Cache entry - Implements ::hash_hdata_free_t - @ingroup hash_hdata_free_api
+ */
+static void bcache_entry_free(int type, void *obj, intptr_t data)
+{
+  struct BcacheEntry *entry = obj;
+  FREE(&entry->path);
+  FREE(&entry);
+}
+
+/**
+ * bcache_index_add - Add (or update) a file in the index
+ * @param path Path of the file
+ * @param used When the file was last used
+ */
+static void bcache_index_add(const char *path, time_t used)
+{
+  if (!BcacheIndex)
+    return;
+
+  struct stat st = { 0 };
+  if ((lstat(path, &st) != 0) || !S_ISREG(st.st_mode))
+    return;
+
+  struct BcacheEntry *entry = mutt_hash_find(BcacheIndex, path);
+  if (entry)
+  {
+    BcacheSize -= entry->size;
+  }
+  else
+  {
+    entry = mutt_mem_calloc(1, sizeof(struct BcacheEntry));
+    entry->path = mutt_str_dup(path);
+    mutt_hash_insert(BcacheIndex, entry->path, entry);
+  }
+  entry->size = st.st_size;
+  entry->used = used;
+  BcacheSize += entry->size;
+}
+
+/**
+ * bcache_index_del - Remove a file from the index
+ * @param path Path of the file
+ */
+static void bcache_index_del(const char *path)
+{
+  if (!BcacheIndex)
+    return;
+
+  struct BcacheEntry *entry = mutt_hash_find(BcacheIndex, path);
+  if (!entry)
+    return;
+
+  BcacheSize -= entry->size;
+  mutt_hash_delete(BcacheIndex, path, entry);
+}
+
+/**
+ * bcache_is_shard - Is this the name of a shard directory?
+ * @param name File name
+ * @retval true It's a shard, e.g. "@3f"
+ */
+static bool bcache_is_shard(const char *name)
+{
+  return (name[0] == '@') && isxdigit(name[1]) && isxdigit(name[2]) && (name[3] == '\0');
+}
+
+/**
+ * bcache_index_scan - Add the committed files in a directory to the index
+ * @param dir   Directory to scan, ending in '/', will be restored on return
+ * @param shard true if the directory is a shard
+ *
+ * Hidden files, temporary files and directories other than shards, e.g. the
+ * caches of child mailboxes, are skipped.
+ */
+static void bcache_index_scan(struct Buffer *dir, bool shard)
+{
+  DIR *dp = mutt_file_opendir(buf_string(dir), MUTT_OPENDIR_NONE);
+  if (!dp)
+    return;
+
+  const size_t dirlen = buf_len(dir);
+  struct dirent *de = NULL;
+  while ((de = readdir(dp)))
+  {
+    if (de->d_name[0] == '.')
+      continue;
+
+    const bool is_shard = !shard && bcache_is_shard(de->d_name);
+    if (!is_shard && mutt_str_equal(strrchr(de->d_name, '.'), ".tmp"))
+      continue;
+
+    buf_addstr(dir, de->d_name);
+
+    struct stat st = { 0 };
+    if (lstat(buf_string(dir), &st) == 0)
+    {
+      if (is_shard && S_ISDIR(st.st_mode))
+      {
+        buf_addch(dir, '/');
+        bcache_index_scan(dir, true);
+      }
+      else if (!is_shard && S_ISREG(st.st_mode))
+      {
+        bcache_index_add(buf_string(dir), st.st_mtime);
+      }
+    }
+
+    dir->data[dirlen] = '\0';
+    buf_fix_dptr(dir);
+  }
+  closedir(dp);
+}
+
+/**
+ * bcache_index_load - Add a Body Cache to the index
+ * @param bcache Body Cache
+ *
+ * Each Body Cache directory is only read once.  After that, the index is kept
+ * up to date as files are added, used and removed.
+ */
+static void bcache_index_load(struct BodyCache *bcache)
+{
+  const char *const c_message_cache_dir = cs_subset_path(NeoMutt->sub, "message_cache_dir");
+  if (!BcacheIndex || !mutt_str_equal(BcacheIndexDir, c_message_cache_dir))
+  {
+    mutt_bcache_cleanup();
+    BcacheIndex = mutt_hash_new(1024, MUTT_HASH_NO_FLAGS);
+    mutt_hash_set_destructor(BcacheIndex, bcache_entry_free, 0);
+    BcacheIndexDirs = mutt_hash_new(32, MUTT_HASH_STRDUP_KEYS);
+    BcacheIndexDir = mutt_str_dup(c_message_cache_dir);
+    BcacheSize = 0;
+  }
+
+  if (mutt_hash_find(BcacheIndexDirs, bcache->path))
+    return;
+
+  mutt_hash_insert(BcacheIndexDirs, bcache->path, BcacheIndexDirs);
+
+  struct Buffer *dir = buf_pool_get();
+  buf_strcpy(dir, bcache->path);
+  bcache_index_scan(dir, false);
+  buf_pool_release(&dir);
+
+  mutt_debug(LL_DEBUG3, "bcache: index: '%s': total %jd bytes\n", bcache->path,
+             (intmax_t) BcacheSize);
+}
+
+/**
+ * bcache_file_path - Get the path of a message in the Body Cache
+ * @param[in]  bcache Body Cache
+ * @param[in]  id     Per-mailbox unique identifier for the message
+ * @param[in]  legacy If true, get the path used before the cache was sharded
+ * @param[out] dest   Buffer for the path
+ *
+ * Messages are spread over 256 shards, directories "@00" to "@ff", chosen by
+ * a hash of their id.  mutt_encode_path() never creates an '@', so a shard
+ * can't clash with the cache of a child mailbox.
+ */
+static void bcache_file_path(struct BodyCache *bcache, const char *id,
+                             bool legacy, struct Buffer *dest)
+{
+  if (legacy)
+  {
+    buf_printf(dest, "%s%s", bcache->path, id);
+    return;
+  }
+
+  unsigned int hash = 5381;
+  for (const unsigned char *p = (const unsigned char *) id; *p; p++)
+    hash = (hash * 33) + *p;
+
+  buf_printf(dest, "%s@%02x/%s", bcache->path, hash & 0xff, id);
+}
+
+/**
+ * bcache_find - Find a message in the Body Cache
+ * @param[in]  bcache Body Cache
+ * @param[in]  id     Per-mailbox unique identifier for the message
+ * @param[out] dest   Buffer for the path
+ * @param[out] st     Details of the file
+ * @retval true The message is in the cache
+ *
+ * Messages cached before the cache was sharded are still found.
+ */
+static bool bcache_find(struct BodyCache *bcache, const char *id,
+                        struct Buffer *dest, struct stat *st)
+{
+  bcache_file_path(bcache, id, false, dest);
+  if (stat(buf_string(dest), st) == 0)
+    return true;
+
+  bcache_file_path(bcache, id, true, dest);
+  return (stat(buf_string(dest), st) == 0);
+}
+
+/**
+ * bcache_shared_path - Get the path of a message in the shared store
+ * @param[in]  key  Identifier of the message's contents, or NULL for the directory
+ * @param[out] dest Buffer for the path
+ * @retval  0 Success
+ * @retval -1 Failure
+ */
+static int bcache_shared_path(const char *key, struct Buffer *dest)
+{
+  const char *const c_message_cache_dir = cs_subset_path(NeoMutt->sub, "message_cache_dir");
+  if (!c_message_cache_dir || (key && (*key == '\0')))
+    return -1;
+
+  buf_printf(dest, "%s/.shared", c_message_cache_dir);
+  if (key)
+    buf_add_printf(dest, "/%s", key);
+  return 0;
+}
+
+/**
+ * mutt_bcache_clean_shared - Remove the shared messages that no mailbox uses
+ *
+ * A shared message that is no longer linked from any mailbox's cache only has
+ * one link left, its own.
+ */
+void mutt_bcache_clean_shared(void)
+{
+  struct Buffer *path = buf_pool_get();
+  if (bcache_shared_path(NULL, path) < 0)
+    goto done;
+
+  DIR *dp = mutt_file_opendir(buf_string(path), MUTT_OPENDIR_NONE);
+  if (!dp)
+    goto done;
+
+  const size_t dirlen = buf_len(path);
+  struct dirent *de = NULL;
+  while ((de = readdir(dp)))
+  {
+    if (de->d_name[0] == '.')
+      continue;
+
+    buf_add_printf(path, "/%s", de->d_name);
+    struct stat st = { 0 };
+    if ((lstat(buf_string(path), &st) == 0) && S_ISREG(st.st_mode) && (st.st_nlink == 1))
+    {
+      mutt_debug(LL_DEBUG3, "bcache: unshare: '%s'\n", buf_string(path));
+      unlink(buf_string(path));
+      bcache_index_del(buf_string(path));
+    }
+    path->data[dirlen] = '\0';
+    buf_fix_dptr(path);
+  }
+  closedir(dp);
+
+done:
+  buf_pool_release(&path);
+}
+
+/**
+ * bcache_entry_cmp - Compare two Body Cache entries by when they were used - Implements ::sort_t - @ingroup sort_api
+ */
+static int bcache_entry_cmp(const void *a, const void *b, void *sdata)
+{
+  const struct BcacheEntry *ea = *(struct BcacheEntry const *const *) a;
+  const struct BcacheEntry *eb = *(struct BcacheEntry const *const *) b;
+
+  return mutt_numeric_cmp(ea->used, eb->used);
+}
+
+/**
+ * bcache_trim - Remove the least recently used files from $message_cache_dir
+ * @param limit Maximum size of the cache, in bytes
+ *
+ * To avoid trimming on every commit, the cache is trimmed to 90% of the limit.
+ *
+ * Every link to a file is counted, so a message that's shared between
+ * mailboxes counts more than once.
+ */
+static void bcache_trim(long limit)
+{
+  if (!BcacheIndex || (BcacheSize <= limit))
+    return;
+
+  /* Shared messages that nothing uses are the first to go */
+  mutt_bcache_clean_shared();
+  if (BcacheSize <= limit)
+    return;
+
+  struct BcacheEntryArray entries = ARRAY_HEAD_INITIALIZER;
+  struct HashWalkState state = { 0 };
+  struct HashElem *he = NULL;
+  while ((he = mutt_hash_walk(BcacheIndex, &state)))
+    ARRAY_ADD(&entries, he->data);
+
+  ARRAY_SORT(&entries, bcache_entry_cmp, NULL);
+
+  const off_t target = limit - (limit / 10);
+  struct BcacheEntry **ep = NULL;
+  ARRAY_FOREACH(ep, &entries)
+  {
+    if (BcacheSize <= target)
+      break;
+
+    struct BcacheEntry *entry = *ep;
+    mutt_debug(LL_DEBUG3, "bcache: evict: '%s'\n", entry->path);
+    if ((unlink(entry->path) == 0) || (errno == ENOENT))
+    {
+      BcacheSize -= entry->size;
+      mutt_hash_delete(BcacheIndex, entry->path, entry);
+    }
+  }
+  ARRAY_FREE(&entries);
+}
+
 /**
  * bcache_path - Create the cache path for a given account/mailbox
  * @param account Account info
@@ -108,33 +444,6 @@ static int bcache_path(struct ConnAccount *account, const char *mailbox, struct
   return 0;
 }
 
-/**
- * mutt_bcache_move - Change the id of a message in the cache
- * @param bcache Body cache
- * @param id     Per-mailbox unique identifier for the message
- * @param newid  New id for the message
- * @retval  0 Success
- * @retval -1 Error
- */
-static int mutt_bcache_move(struct BodyCache *bcache, const char *id, const char *newid)
-{
-  if (!bcache || !id || (*id == '\0') || !newid || (*newid == '\0'))
-    return -1;
-
-  struct Buffer *path = buf_pool_get();
-  struct Buffer *newpath = buf_pool_get();
-
-  buf_printf(path, "%s%s", bcache->path, id);
-  buf_printf(newpath, "%s%s", bcache->path, newid);
-
-  mutt_debug(LL_DEBUG3, "bcache: mv: '%s' '%s'\n", buf_string(path), buf_string(newpath));
-
-  int rc = rename(buf_string(path), buf_string(newpath));
-  buf_pool_release(&path);
-  buf_pool_release(&newpath);
-  return rc;
-}
-
 /**
  * mutt_bcache_open - Open an Email-Body Cache
  * @param account current mailbox' account (required)
@@ -190,13 +499,21 @@ FILE *mutt_bcache_get(struct BodyCache *bcache, const char *id)
     return NULL;
 
   struct Buffer *path = buf_pool_get();
-  buf_addstr(path, bcache->path);
-  buf_addstr(path, id);
-
-  FILE *fp = mutt_file_fopen(buf_string(path), "r");
+  struct stat st = { 0 };
+  FILE *fp = NULL;
+  if (bcache_find(bcache, id, path, &st))
+    fp = mutt_file_fopen(buf_string(path), "r");
 
   mutt_debug(LL_DEBUG3, "bcache: get: '%s': %s\n", buf_string(path), fp ? "yes" : "no");
 
+  /* The file's mtime is only updated by mutt_bcache_cleanup() */
+  struct BcacheEntry *entry = (fp && BcacheIndex) ? mutt_hash_find(BcacheIndex, buf_string(path)) : NULL;
+  if (entry)
+  {
+    entry->used = mutt_date_now();
+    entry->dirty = true;
+  }
+
   buf_pool_release(&path);
   return fp;
 }
@@ -216,27 +533,29 @@ FILE *mutt_bcache_put(struct BodyCache *bcache, const char *id)
   if (!id || (*id == '\0') || !bcache)
     return NULL;
 
-  struct Buffer *path = buf_pool_get();
-  buf_printf(path, "%s%s%s", bcache->path, id, ".tmp");
-
   struct stat st = { 0 };
-  if (stat(bcache->path, &st) == 0)
+  if ((stat(bcache->path, &st) == 0) && !S_ISDIR(st.st_mode))
   {
-    if (!S_ISDIR(st.st_mode))
-    {
-      mutt_error(_("Message cache isn't a directory: %s"), bcache->path);
-      return NULL;
-    }
+    mutt_error(_("Message cache isn't a directory: %s"), bcache->path);
+    return NULL;
   }
-  else
+
+  struct Buffer *path = buf_pool_get();
+  bcache_file_path(bcache, id, false, path);
+
+  /* Create the shard, and the cache, if necessary */
+  char *slash = strrchr(path->data, '/');
+  *slash = '\0';
+  int rc = mutt_file_mkdir(buf_string(path), S_IRWXU | S_IRWXG | S_IRWXO);
+  *slash = '/';
+  if (rc < 0)
   {
-    if (mutt_file_mkdir(bcache->path, S_IRWXU | S_IRWXG | S_IRWXO) < 0)
-    {
-      mutt_error(_("Can't create %s: %s"), bcache->path, strerror(errno));
-      return NULL;
-    }
+    mutt_error(_("Can't create %s: %s"), buf_string(path), strerror(errno));
+    buf_pool_release(&path);
+    return NULL;
   }
 
+  buf_addstr(path, ".tmp");
   mutt_debug(LL_DEBUG3, "bcache: put: '%s'\n", buf_string(path));
 
   FILE *fp = mutt_file_fopen(buf_string(path), "w+");
@@ -250,14 +569,40 @@ FILE *mutt_bcache_put(struct BodyCache *bcache, const char *id)
  * @param id     Per-mailbox unique identifier for the message
  * @retval  0 Success
  * @retval -1 Failure
+ *
+ * A copy of the message from before the cache was sharded is removed.
  */
 int mutt_bcache_commit(struct BodyCache *bcache, const char *id)
 {
-  struct Buffer *tmpid = buf_pool_get();
-  buf_printf(tmpid, "%s.tmp", id);
+  if (!id || (*id == '\0') || !bcache)
+    return -1;
+
+  struct Buffer *path = buf_pool_get();
+  struct Buffer *tmppath = buf_pool_get();
+
+  bcache_file_path(bcache, id, false, path);
+  buf_printf(tmppath, "%s.tmp", buf_string(path));
+
+  mutt_debug(LL_DEBUG3, "bcache: mv: '%s' '%s'\n", buf_string(tmppath), buf_string(path));
+  int rc = rename(buf_string(tmppath), buf_string(path));
+
+  if (rc == 0)
+  {
+    bcache_file_path(bcache, id, true, tmppath);
+    if (unlink(buf_string(tmppath)) == 0)
+      bcache_index_del(buf_string(tmppath));
+  }
 
-  int rc = mutt_bcache_move(bcache, buf_string(tmpid), id);
-  buf_pool_release(&tmpid);
+  const long c_message_cache_size = cs_subset_long(NeoMutt->sub, "message_cache_size");
+  if ((rc == 0) && (c_message_cache_size > 0))
+  {
+    bcache_index_load(bcache);
+    bcache_index_add(buf_string(path), mutt_date_now());
+    bcache_trim(c_message_cache_size);
+  }
+
+  buf_pool_release(&path);
+  buf_pool_release(&tmppath);
   return rc;
 }
 
@@ -274,12 +619,13 @@ int mutt_bcache_del(struct BodyCache *bcache, const char *id)
     return -1;
 
   struct Buffer *path = buf_pool_get();
-  buf_addstr(path, bcache->path);
-  buf_addstr(path, id);
+  struct stat st = { 0 };
+  bcache_find(bcache, id, path, &st);
 
   mutt_debug(LL_DEBUG3, "bcache: del: '%s'\n", buf_string(path));
 
   int rc = unlink(buf_string(path));
+  bcache_index_del(buf_string(path));
   buf_pool_release(&path);
   return rc;
 }
@@ -297,14 +643,10 @@ int mutt_bcache_exists(struct BodyCache *bcache, const char *id)
     return -1;
 
   struct Buffer *path = buf_pool_get();
-  buf_addstr(path, bcache->path);
-  buf_addstr(path, id);
-
-  int rc = 0;
   struct stat st = { 0 };
-  if (stat(buf_string(path), &st) < 0)
-    rc = -1;
-  else
+
+  int rc = -1;
+  if (bcache_find(bcache, id, path, &st))
     rc = (S_ISREG(st.st_mode) && (st.st_size != 0)) ? 0 : -1;
 
   mutt_debug(LL_DEBUG3, "bcache: exists: '%s': %s\n", buf_string(path),
@@ -315,58 +657,226 @@ int mutt_bcache_exists(struct BodyCache *bcache, const char *id)
 }
 
 /**
- * mutt_bcache_list - Find matching entries in the Body Cache
+ * mutt_bcache_share - Make a cached message available to other mailboxes
  * @param bcache Body Cache from mutt_bcache_open()
- * @param want_id Callback function called for each match
- * @param data    Data to pass to the callback function
- * @retval -1  Failure
- * @retval >=0 count of matching items
+ * @param id     Per-mailbox unique identifier for the message
+ * @param key    Identifier of the message's contents
+ * @retval  0 Success
+ * @retval -1 Failure
  *
- * This more or less "examines" the cache and calls a function with
- * each id it finds if given.
+ * The message is hard-linked into a store shared by all Body Caches.  The
+ * caller's key decides which mailboxes can find it.  If the store already has
+ * a different copy, the mailbox keeps its own, freshly downloaded, one.
+ */
+int mutt_bcache_share(struct BodyCache *bcache, const char *id, const char *key)
+{
+  if (!id || (*id == '\0') || !bcache)
+    return -1;
+
+  struct Buffer *shared = buf_pool_get();
+  struct Buffer *path = buf_pool_get();
+  int rc = -1;
+
+  if ((bcache_shared_path(NULL, shared) < 0) ||
+      (mutt_file_mkdir(buf_string(shared), S_IRWXU) < 0) ||
+      (bcache_shared_path(key, shared) < 0))
+  {
+    goto done;
+  }
+
+  struct stat st = { 0 };
+  if (!bcache_find(bcache, id, path, &st))
+    goto done;
+
+  if (link(buf_string(path), buf_string(shared)) == 0)
+  {
+    mutt_debug(LL_DEBUG3, "bcache: share: '%s' as '%s'\n", buf_string(path), key);
+    bcache_index_add(buf_string(shared), mutt_date_now());
+    rc = 0;
+  }
+
+done:
+  buf_pool_release(&shared);
+  buf_pool_release(&path);
+  return rc;
+}
+
+/**
+ * mutt_bcache_shared_exists - Is a message in the shared store?
+ * @param key Identifier of the message's contents
+ * @retval  0 Success
+ * @retval -1 Failure
+ */
+int mutt_bcache_shared_exists(const char *key)
+{
+  struct Buffer *shared = buf_pool_get();
+  int rc = -1;
+
+  struct stat st = { 0 };
+  if ((bcache_shared_path(key, shared) == 0) && (stat(buf_string(shared), &st) == 0) &&
+      S_ISREG(st.st_mode) && (st.st_size != 0))
+  {
+    rc = 0;
+  }
+
+  buf_pool_release(&shared);
+  return rc;
+}
+
+/**
+ * mutt_bcache_reuse - Fill the Body Cache from the shared store
+ * @param bcache Body Cache from mutt_bcache_open()
+ * @param id     Per-mailbox unique identifier for the message
+ * @param key    Identifier of the message's contents
+ * @retval  0 Success, the message is now in the cache
+ * @retval -1 Failure
  *
- * The optional callback function gets the id of a message, the very same
- * body cache handle mutt_bcache_list() is called with (to, perhaps,
- * perform further operations on the bcache), and a data cookie which is
- * just passed as-is. If the return value of the callback is non-zero, the
- * listing is aborted and continued otherwise. The callback is optional
- * so that this function can be used to count the items in the cache
- * (see below for return value).
+ * If another mailbox has shared a copy of the message, with
+ * mutt_bcache_share(), link to it rather than downloading it again.
  */
-int mutt_bcache_list(struct BodyCache *bcache, bcache_list_t want_id, void *data)
+int mutt_bcache_reuse(struct BodyCache *bcache, const char *id, const char *key)
 {
-  DIR *dir = NULL;
-  struct dirent *de = NULL;
+  if (!id || (*id == '\0') || !bcache || (mutt_bcache_shared_exists(key) < 0))
+    return -1;
+
+  struct Buffer *shared = buf_pool_get();
+  struct Buffer *path = buf_pool_get();
   int rc = -1;
 
-  if (!bcache || !(dir = mutt_file_opendir(bcache->path, MUTT_OPENDIR_NONE)))
-    goto out;
+  if (bcache_shared_path(key, shared) < 0)
+    goto done;
 
-  rc = 0;
+  /* Create the shard, and the cache, if necessary */
+  bcache_file_path(bcache, id, false, path);
+  char *slash = strrchr(path->data, '/');
+  *slash = '\0';
+  int rc_mkdir = mutt_file_mkdir(buf_string(path), S_IRWXU | S_IRWXG | S_IRWXO);
+  *slash = '/';
+  if (rc_mkdir < 0)
+    goto done;
+
+  if (link(buf_string(shared), buf_string(path)) == 0)
+  {
+    mutt_debug(LL_DEBUG3, "bcache: reuse: '%s' from '%s'\n", buf_string(path), key);
+    bcache_index_add(buf_string(path), mutt_date_now());
+    rc = 0;
+  }
 
-  mutt_debug(LL_DEBUG3, "bcache: list: dir: '%s'\n", bcache->path);
+done:
+  buf_pool_release(&shared);
+  buf_pool_release(&path);
+  return rc;
+}
 
-  while ((de = readdir(dir)))
+/**
+ * mutt_bcache_cleanup - Free the index of the Body Caches
+ *
+ * The time each file was last used is saved as its mtime, so the LRU order
+ * survives a restart.
+ */
+void mutt_bcache_cleanup(void)
+{
+  if (BcacheIndex)
   {
-    if (mutt_str_startswith(de->d_name, ".") || mutt_str_startswith(de->d_name, ".."))
+    struct HashWalkState state = { 0 };
+    struct HashElem *he = NULL;
+    while ((he = mutt_hash_walk(BcacheIndex, &state)))
     {
+      struct BcacheEntry *entry = he->data;
+      if (!entry->dirty)
+        continue;
+
+      struct utimbuf utim = { entry->used, entry->used };
+      utime(entry->path, &utim);
+    }
+  }
+
+  mutt_hash_free(&BcacheIndex);
+  mutt_hash_free(&BcacheIndexDirs);
+  FREE(&BcacheIndexDir);
+  BcacheSize = 0;
+}
+
+/**
+ * bcache_list_dir - List the entries in a Body Cache directory
+ * @param[in]  bcache  Body Cache from mutt_bcache_open()
+ * @param[in]  path    Directory to list
+ * @param[in]  shard   true if the directory is a shard
+ * @param[in]  want_id Callback function called for each match
+ * @param[in]  data    Data to pass to the callback function
+ * @param[out] stop    Set to true if the callback aborted the listing
+ * @retval -1  Failure
+ * @retval >=0 count of matching items
+ */
+static int bcache_list_dir(struct BodyCache *bcache, const char *path, bool shard,
+                           bcache_list_t want_id, void *data, bool *stop)
+{
+  DIR *dir = mutt_file_opendir(path, MUTT_OPENDIR_NONE);
+  if (!dir)
+    return -1;
+
+  mutt_debug(LL_DEBUG3, "bcache: list: dir: '%s'\n", path);
+
+  int rc = 0;
+  struct dirent *de = NULL;
+  while (!*stop && (de = readdir(dir)))
+  {
+    if (mutt_str_startswith(de->d_name, "."))
+      continue;
+
+    if (!shard && bcache_is_shard(de->d_name))
+    {
+      struct Buffer *sub = buf_pool_get();
+      buf_printf(sub, "%s%s/", path, de->d_name);
+      int count = bcache_list_dir(bcache, buf_string(sub), true, want_id, data, stop);
+      buf_pool_release(&sub);
+      if (count > 0)
+        rc += count;
       continue;
     }
 
-    mutt_debug(LL_DEBUG3, "bcache: list: dir: '%s', id :'%s'\n", bcache->path, de->d_name);
+    mutt_debug(LL_DEBUG3, "bcache: list: dir: '%s', id :'%s'\n", path, de->d_name);
 
     if (want_id && (want_id(de->d_name, bcache, data) != 0))
-      goto out;
+    {
+      *stop = true;
+      break;
+    }
 
     rc++;
   }
 
-out:
-  if (dir)
-  {
-    if (closedir(dir) < 0)
-      rc = -1;
-  }
+  if (closedir(dir) < 0)
+    rc = -1;
+  return rc;
+}
+
+/**
+ * mutt_bcache_list - Find matching entries in the Body Cache
+ * @param bcache Body Cache from mutt_bcache_open()
+ * @param want_id Callback function called for each match
+ * @param data    Data to pass to the callback function
+ * @retval -1  Failure
+ * @retval >=0 count of matching items
+ *
+ * This more or less "examines" the cache and calls a function with
+ * each id it finds if given.
+ *
+ * The optional callback function gets the id of a message, the very same
+ * body cache handle mutt_bcache_list() is called with (to, perhaps,
+ * perform further operations on the bcache), and a data cookie which is
+ * just passed as-is. If the return value of the callback is non-zero, the
+ * listing is aborted and continued otherwise. The callback is optional
+ * so that this function can be used to count the items in the cache
+ * (see below for return value).
+ */
+int mutt_bcache_list(struct BodyCache *bcache, bcache_list_t want_id, void *data)
+{
+  if (!bcache)
+    return -1;
+
+  bool stop = false;
+  int rc = bcache_list_dir(bcache, bcache->path, false, want_id, data, &stop);
   mutt_debug(LL_DEBUG3, "bcache: list: did %d entries\n", rc);
   return rc;
 }
@@ -53,13 +53,18 @@ struct BodyCache;
  */
 typedef int (*bcache_list_t)(const char *id, struct BodyCache *bcache, void *data);
 
-void              mutt_bcache_close (struct BodyCache **ptr);
-int               mutt_bcache_commit(struct BodyCache *bcache, const char *id);
-int               mutt_bcache_del   (struct BodyCache *bcache, const char *id);
-int               mutt_bcache_exists(struct BodyCache *bcache, const char *id);
-FILE *            mutt_bcache_get   (struct BodyCache *bcache, const char *id);
-int               mutt_bcache_list  (struct BodyCache *bcache, bcache_list_t want_id, void *data);
-struct BodyCache *mutt_bcache_open  (struct ConnAccount *account, const char *mailbox);
-FILE *            mutt_bcache_put   (struct BodyCache *bcache, const char *id);
+void              mutt_bcache_clean_shared (void);
+void              mutt_bcache_cleanup      (void);
+void              mutt_bcache_close        (struct BodyCache **ptr);
+int               mutt_bcache_commit       (struct BodyCache *bcache, const char *id);
+int               mutt_bcache_del          (struct BodyCache *bcache, const char *id);
+int               mutt_bcache_exists       (struct BodyCache *bcache, const char *id);
+FILE *            mutt_bcache_get          (struct BodyCache *bcache, const char *id);
+int               mutt_bcache_list         (struct BodyCache *bcache, bcache_list_t want_id, void *data);
+struct BodyCache *mutt_bcache_open         (struct ConnAccount *account, const char *mailbox);
+FILE *            mutt_bcache_put          (struct BodyCache *bcache, const char *id);
+int               mutt_bcache_reuse        (struct BodyCache *bcache, const char *id, const char *key);
+int               mutt_bcache_share        (struct BodyCache *bcache, const char *id, const char *key);
+int               mutt_bcache_shared_exists(const char *key);
 
 #endif /* MUTT_BCACHE_LIB_H */
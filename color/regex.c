@@ -62,6 +62,9 @@ struct RegexColorList IndexTagsList;      ///< List of colours applied to the ta
 struct RegexColorList StatusList;         ///< List of colours applied to the status bar
 // clang-format on
 
+/// Patterns of each RegexColorList, keyed by pattern, to find duplicates quickly
+static struct HashTable *RegexColorIndex[MT_COLOR_MAX] = { 0 };
+
 /**
  * regex_colors_init - Initialise the Regex colours
  */
@@ -106,6 +109,9 @@ void regex_colors_cleanup(void)
   regex_color_list_clear(&IndexSubjectList);
   regex_color_list_clear(&IndexTagList);
   regex_color_list_clear(&StatusList);
+
+  for (enum ColorId cid = 0; cid < MT_COLOR_MAX; cid++)
+    mutt_hash_free(&RegexColorIndex[cid]);
 }
 
 /**
@@ -223,6 +229,7 @@ struct RegexColorList *regex_colors_get_list(enum ColorId cid)
 /**
  * add_pattern - Associate a colour to a pattern
  * @param rcl       List of existing colours
+ * @param index     Index of the patterns in the list
  * @param s         String to match
  * @param sensitive true if the pattern case-sensitive
  * @param ac_val    Colour value to use
@@ -234,18 +241,35 @@ struct RegexColorList *regex_colors_get_list(enum ColorId cid)
  * is_index used to store compiled pattern only for 'index' color object when
  * called from mutt_parse_color()
  */
-static enum CommandResult add_pattern(struct RegexColorList *rcl, const char *s,
+static enum CommandResult add_pattern(struct RegexColorList *rcl,
+                                      struct HashTable **index, const char *s,
                                       bool sensitive, struct AttrColor *ac_val,
                                       struct Buffer *err, bool is_index, int match)
 {
   struct RegexColor *rcol = NULL;
+  int found = 0;
 
-  STAILQ_FOREACH(rcol, rcl, entries)
+  struct HashElem *he = mutt_hash_find_bucket(*index, s);
+  for (; he; he = he->next)
   {
-    if ((sensitive && mutt_str_equal(s, rcol->pattern)) ||
-        (!sensitive && mutt_istr_equal(s, rcol->pattern)))
+    if ((sensitive && mutt_str_equal(s, he->key.strkey)) ||
+        (!sensitive && mutt_istr_equal(s, he->key.strkey)))
     {
-      break;
+      rcol = he->data;
+      found++;
+    }
+  }
+
+  if (found > 1)
+  {
+    /* Several patterns differ only in case; use the first in the list */
+    STAILQ_FOREACH(rcol, rcl, entries)
+    {
+      if ((sensitive && mutt_str_equal(s, rcol->pattern)) ||
+          (!sensitive && mutt_istr_equal(s, rcol->pattern)))
+      {
+        break;
+      }
     }
   }
 
@@ -297,6 +321,10 @@ static enum CommandResult add_pattern(struct RegexColorList *rcl, const char *s,
     attr_color_overwrite(ac, ac_val);
 
     STAILQ_INSERT_TAIL(rcl, rcol, entries);
+
+    if (!*index)
+      *index = mutt_hash_new(127, MUTT_HASH_STRCASECMP | MUTT_HASH_ALLOW_DUPS);
+    mutt_hash_insert(*index, rcol->pattern, rcol);
   }
 
   if (is_index)
@@ -362,7 +390,7 @@ bool regex_colors_parse_color_list(enum ColorId cid, const char *pat,
       return false;
   }
 
-  *rc = add_pattern(rcl, pat, sensitive, ac, err, is_index, 0);
+  *rc = add_pattern(rcl, &RegexColorIndex[cid], pat, sensitive, ac, err, is_index, 0);
 
   struct Buffer *buf = buf_pool_get();
   get_colorid_name(cid, buf);
@@ -393,7 +421,7 @@ int regex_colors_parse_status_list(enum ColorId cid, const char *pat,
   if (cid != MT_COLOR_STATUS)
     return MUTT_CMD_ERROR;
 
-  int rc = add_pattern(&StatusList, pat, true, ac, err, false, match);
+  int rc = add_pattern(&StatusList, &RegexColorIndex[cid], pat, true, ac, err, false, match);
   if (rc != MUTT_CMD_SUCCESS)
     return rc;
 
@@ -431,6 +459,7 @@ bool regex_colors_parse_uncolor(enum ColorId cid, const char *pat, bool uncolor)
     notify_send(ColorsNotify, NT_COLOR, NT_COLOR_RESET, &ev_c);
 
     regex_color_list_clear(cl);
+    mutt_hash_free(&RegexColorIndex[cid]);
     return true;
   }
 
@@ -453,6 +482,7 @@ bool regex_colors_parse_uncolor(enum ColorId cid, const char *pat, bool uncolor)
       struct EventColor ev_c = { cid, &np->attr_color };
       notify_send(ColorsNotify, NT_COLOR, NT_COLOR_RESET, &ev_c);
 
+      mutt_hash_delete(RegexColorIndex[cid], np->pattern, np);
       regex_color_free(cl, &np);
       break;
     }
@@ -0,0 +1,100 @@
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#define ALL_TARGETS "all-po all-data all-docs all-contrib all-test"
+#define BINDIR "/usr/bin"
+#define CLEAN_TARGETS "clean-po clean-data clean-docs clean-contrib clean-test"
+#define COMPILER_IS_GCC 1
+#define CRYPT_BACKEND_CLASSIC_PGP 1
+#define CRYPT_BACKEND_CLASSIC_SMIME 1
+#define HAVE_BKGRNDSET 1
+#define HAVE_CFLAG_STD_C11 1
+#define HAVE_CLOCK_GETTIME 1
+/* #undef HAVE_DECL_SYS_SIGLIST */
+#define HAVE_DECL_X509_V_FLAG_PARTIAL_CHAIN 1
+#define HAVE_DEFLATE 1
+#define HAVE_FGETC_UNLOCKED 1
+#define HAVE_FUTIMENS 1
+#define HAVE_GETADDRINFO 1
+#define HAVE_GETADDRINFO_A 1
+#define HAVE_GETHOSTENT 1
+#define HAVE_GETRANDOM 1
+#define HAVE_GETSID 1
+#define HAVE_ICONV 1
+#define HAVE_ICONV_H 1
+#define HAVE_INOTIFY_ADD_WATCH 1
+#define HAVE_INOTIFY_INIT 1
+#define HAVE_INOTIFY_INIT1 1
+#define HAVE_INOTIFY_RM_WATCH 1
+/* #undef HAVE_IOCTL_H */
+#define HAVE_ISWBLANK 1
+#define HAVE_LFS 1
+#define HAVE_LITTLE_ENDIAN 1
+/* #undef HAVE_MINIX_CONFIG_H */
+#define HAVE_MKDTEMP 1
+#define HAVE_NANOSLEEP 1
+#define HAVE_NCURSESW_NCURSES_H 1
+#define HAVE_OPENSSL_SSL_H 1
+/* #undef HAVE_PCRE2_REGCOMP */
+#define HAVE_PGP 1
+#define HAVE_PKG_CONFIG 1
+#define HAVE_PKG_OPENSSL 1
+#define HAVE_QSORT_R 1
+/* #undef HAVE_QSORT_S */
+/* #undef HAVE_RAND_EGD */
+#define HAVE_SETCCHAR 1
+#define HAVE_SETSOCKOPT 1
+#define HAVE_SIGNAL_H 1
+#define HAVE_SMIME 1
+#define HAVE_SSL_PARTIAL_CHAIN 1
+#define HAVE_STDLIB_H 1
+#define HAVE_STRCASESTR 1
+#define HAVE_STRSEP 1
+#define HAVE_STRUCT_STAT_ST_ATIM_TV_NSEC 1
+#define HAVE_STRUCT_TIMESPEC 1
+#define HAVE_SYSCALL_H 1
+#define HAVE_SYSEXITS_H 1
+#define HAVE_SYS_INOTIFY_H 1
+#define HAVE_SYS_IOCTL_H 1
+#define HAVE_SYS_PARAM_H 1
+#define HAVE_SYS_RANDOM_H 1
+#define HAVE_SYS_STAT_H 1
+#define HAVE_SYS_SYSCALL_H 1
+#define HAVE_SYS_TYPES_H 1
+/* #undef HAVE_TCGETWINSIZE */
+#define HAVE_TERMIOS_H 1
+#define HAVE_TGETENT 1
+#define HAVE_TIMEGM 1
+#define HAVE_TIME_H 1
+#define HAVE_UNISTD_H 1
+#define HAVE_USE_EXTENDED_NAMES 1
+/* #undef HAVE_UTIMESNSAT */
+#define HAVE_VASPRINTF 1
+#define HAVE_WADDNWSTR 1
+#define HAVE_WCSCASECMP 1
+#define HAVE_ZLIB 1
+#define HAVE_ZLIB_H 1
+#define ICONV_CONST 
+#define INSTALL_TARGETS "install-po install-data install-docs install-contrib install-test"
+#define LOFF_T off_t
+#define MAILPATH "/var/mail"
+#define MUTTLOCALEDIR "/usr/share/locale"
+#define OFF_T_FMT "%" PRId64
+#define PACKAGE "neomutt"
+#define PACKAGE_VERSION "20240425"
+#define PKGDATADIR "/usr/share/neomutt"
+#define PKGDOCDIR "/usr/share/doc/neomutt"
+#define SENDMAIL "/usr/sbin/sendmail"
+#define SIZEOF_OFF_T 8
+#define SYSCONFDIR "/etc"
+#define TEST_CASE_MAXSIZE 1024
+#define TMPDIR "/tmp"
+#define UNINSTALL_TARGETS "uninstall-po uninstall-data uninstall-docs uninstall-contrib uninstall-test"
+#define USE_FCNTL 1
+/* #undef USE_FMEMOPEN */
+#define USE_HCACHE_COMPRESSION 1
+#define USE_INOTIFY 1
+#define USE_SSL 1
+#define USE_SSL_OPENSSL 1
+#define USE_ZLIB 1
+#define VPATH "$(SRCDIR)"
+#endif
@@ -48,7 +48,7 @@ struct Connection
 {
   struct ConnAccount account; ///< Account details: username, password, etc
   unsigned int ssf;           ///< Security strength factor, in bits (see notes)
-  char inbuf[1024];           ///< Buffer for incoming traffic
+  char inbuf[16384];          ///< Buffer for incoming traffic, big enough for a TLS record
   int bufpos;                 ///< Current position in the buffer
   int fd;                     ///< Socket file descriptor
   int available;              ///< Amount of data waiting to be read
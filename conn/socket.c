@@ -190,6 +190,39 @@ int mutt_socket_poll(struct Connection *conn, time_t wait_secs)
   return -1;
 }
 
+/**
+ * socket_fill - Refill the Connection's input buffer, if it's empty
+ * @param conn Connection to a server
+ * @retval true  Data is waiting in the buffer
+ * @retval false Error
+ */
+static bool socket_fill(struct Connection *conn)
+{
+  if (conn->bufpos < conn->available)
+    return true;
+
+  if (conn->fd >= 0)
+  {
+    conn->available = conn->read(conn, conn->inbuf, sizeof(conn->inbuf));
+  }
+  else
+  {
+    mutt_debug(LL_DEBUG1, "attempt to read from closed connection\n");
+    return false;
+  }
+  conn->bufpos = 0;
+  if (conn->available == 0)
+  {
+    mutt_error(_("Connection to %s closed"), conn->account.host);
+  }
+  if (conn->available <= 0)
+  {
+    mutt_socket_close(conn);
+    return false;
+  }
+  return true;
+}
+
 /**
  * mutt_socket_readchar - Simple read buffering to speed things up
  * @param[in]  conn Connection to a server
@@ -199,33 +232,43 @@ int mutt_socket_poll(struct Connection *conn, time_t wait_secs)
  */
 int mutt_socket_readchar(struct Connection *conn, char *c)
 {
-  if (conn->bufpos >= conn->available)
-  {
-    if (conn->fd >= 0)
-    {
-      conn->available = conn->read(conn, conn->inbuf, sizeof(conn->inbuf));
-    }
-    else
-    {
-      mutt_debug(LL_DEBUG1, "attempt to read from closed connection\n");
-      return -1;
-    }
-    conn->bufpos = 0;
-    if (conn->available == 0)
-    {
-      mutt_error(_("Connection to %s closed"), conn->account.host);
-    }
-    if (conn->available <= 0)
-    {
-      mutt_socket_close(conn);
-      return -1;
-    }
-  }
+  if (!socket_fill(conn))
+    return -1;
+
   *c = conn->inbuf[conn->bufpos];
   conn->bufpos++;
   return 1;
 }
 
+/**
+ * mutt_socket_readn - Read a block of data from a socket
+ * @param conn Connection to a server
+ * @param buf  Buffer for the data
+ * @param len  Number of bytes to read
+ * @retval >=0 Success, number of bytes read, i.e. len
+ * @retval  -1 Error
+ *
+ * Unlike mutt_socket_read(), this uses the Connection's input buffer, so it
+ * can be mixed with line reads.
+ */
+int mutt_socket_readn(struct Connection *conn, char *buf, size_t len)
+{
+  size_t pos = 0;
+
+  while (pos < len)
+  {
+    if (!socket_fill(conn))
+      return -1;
+
+    const size_t count = MIN((size_t) (conn->available - conn->bufpos), len - pos);
+    memcpy(buf + pos, conn->inbuf + conn->bufpos, count);
+    pos += count;
+    conn->bufpos += count;
+  }
+
+  return pos;
+}
+
 /**
  * mutt_socket_readln_d - Read a line from a socket
  * @param buf    Buffer to store the line
@@ -234,23 +277,36 @@ int mutt_socket_readchar(struct Connection *conn, char *c)
  * @param dbg    Debug level for logging
  * @retval >0 Success, number of bytes read
  * @retval -1 Error
+ *
+ * The line is copied out of the Connection's input buffer a block at a time.
  */
 int mutt_socket_readln_d(char *buf, size_t buflen, struct Connection *conn, int dbg)
 {
-  char ch;
-  int i;
+  size_t i = 0;
 
-  for (i = 0; i < buflen - 1; i++)
+  while (i < (buflen - 1))
   {
-    if (mutt_socket_readchar(conn, &ch) != 1)
+    if (!socket_fill(conn))
     {
       buf[i] = '\0';
       return -1;
     }
 
-    if (ch == '\n')
+    const char *start = conn->inbuf + conn->bufpos;
+    size_t len = MIN((size_t) (conn->available - conn->bufpos), buflen - 1 - i);
+    const char *nl = memchr(start, '\n', len);
+    if (nl)
+      len = nl - start;
+
+    memcpy(buf + i, start, len);
+    i += len;
+    conn->bufpos += len;
+
+    if (nl)
+    {
+      conn->bufpos++; // consume the newline
       break;
-    buf[i] = ch;
+    }
   }
 
   /* strip \r from \r\n termination */
@@ -327,29 +383,34 @@ void mutt_socket_empty(struct Connection *conn)
  */
 int mutt_socket_buffer_readln_d(struct Buffer *buf, struct Connection *conn, int dbg)
 {
-  char ch;
-  bool has_cr = false;
-
   buf_reset(buf);
 
   while (true)
   {
-    if (mutt_socket_readchar(conn, &ch) != 1)
+    if (!socket_fill(conn))
       return -1;
 
-    if (ch == '\n')
-      break;
+    const char *start = conn->inbuf + conn->bufpos;
+    size_t len = conn->available - conn->bufpos;
+    const char *nl = memchr(start, '\n', len);
+    if (nl)
+      len = nl - start;
 
-    if (has_cr)
+    buf_addstr_n(buf, start, len);
+    conn->bufpos += len;
+
+    if (nl)
     {
-      buf_addch(buf, '\r');
-      has_cr = false;
+      conn->bufpos++; // consume the newline
+      break;
     }
+  }
 
-    if (ch == '\r')
-      has_cr = true;
-    else
-      buf_addch(buf, ch);
+  /* strip \r from \r\n termination */
+  if ((buf_len(buf) > 0) && (buf->dptr[-1] == '\r'))
+  {
+    buf->dptr--;
+    *buf->dptr = '\0';
   }
 
   mutt_debug(dbg, "%d< %s\n", conn->fd, buf_string(buf));
@@ -46,6 +46,7 @@ int                mutt_socket_poll    (struct Connection *conn, time_t wait_sec
 int                mutt_socket_read    (struct Connection *conn, char *buf, size_t len);
 int                mutt_socket_readchar(struct Connection *conn, char *c);
 int                mutt_socket_readln_d(char *buf, size_t buflen, struct Connection *conn, int dbg);
+int                mutt_socket_readn   (struct Connection *conn, char *buf, size_t len);
 int                mutt_socket_write_d (struct Connection *conn, const char *buf, int len, int dbg);
 
 /* logging levels */
@@ -44,6 +44,10 @@ static const char *CachedCharset = NULL;
 /// Cached value of $maildir_field_delimiter
 static const char *CachedMaildirFieldDelimiter = NULL;
 
+ARRAY_HEAD(ConfigHandleArray, struct ConfigHandle *);
+/// Config handles that have been looked up
+static struct ConfigHandleArray Handles = ARRAY_HEAD_INITIALIZER;
+
 /**
  * cc_config_observer - Notification that a Config Variable has changed - Implements ::observer_t - @ingroup observer_api
  */
@@ -73,6 +77,18 @@ static int cc_config_observer(struct NotifyCallback *nc)
                                                                          ev_c->he, NULL);
   }
 
+  /* Handles only track the global values */
+  if (NeoMutt && (ev_c->sub == NeoMutt->sub))
+  {
+    struct ConfigHandle **chp = NULL;
+    ARRAY_FOREACH(chp, &Handles)
+    {
+      struct ConfigHandle *ch = *chp;
+      if (mutt_str_equal(ch->name, ev_c->name))
+        ch->value = cs_subset_he_native_get(ev_c->sub, ev_c->he, NULL);
+    }
+  }
+
   mutt_debug(LL_DEBUG5, "config done\n");
   return 0;
 }
@@ -139,6 +155,88 @@ const char *cc_maildir_field_delimiter(void)
   return CachedMaildirFieldDelimiter;
 }
 
+/**
+ * cc_value - Get the cached value of a config variable
+ * @param ch Config handle
+ * @retval num Native value of the variable
+ */
+static intptr_t cc_value(struct ConfigHandle *ch)
+{
+  if (!ch->active)
+  {
+    if (!CacheActive)
+      cache_setup();
+
+    struct HashElem *he = cs_subset_create_inheritance(NeoMutt->sub, ch->name);
+    ASSERT(he);
+    ch->value = cs_subset_he_native_get(NeoMutt->sub, he, NULL);
+    ch->active = true;
+    ARRAY_ADD(&Handles, ch);
+  }
+
+  return ch->value;
+}
+
+/**
+ * cc_bool - Get the cached value of a boolean config variable
+ * @param ch Config handle
+ * @retval bool Value of the variable
+ */
+bool cc_bool(struct ConfigHandle *ch)
+{
+  return (bool) cc_value(ch);
+}
+
+/**
+ * cc_enum - Get the cached value of an enumeration config variable
+ * @param ch Config handle
+ * @retval num Value of the variable
+ */
+unsigned char cc_enum(struct ConfigHandle *ch)
+{
+  return (unsigned char) cc_value(ch);
+}
+
+/**
+ * cc_mbtable - Get the cached value of a multibyte table config variable
+ * @param ch Config handle
+ * @retval ptr Value of the variable
+ */
+const struct MbTable *cc_mbtable(struct ConfigHandle *ch)
+{
+  return (const struct MbTable *) cc_value(ch);
+}
+
+/**
+ * cc_number - Get the cached value of a number config variable
+ * @param ch Config handle
+ * @retval num Value of the variable
+ */
+short cc_number(struct ConfigHandle *ch)
+{
+  return (short) cc_value(ch);
+}
+
+/**
+ * cc_sort - Get the cached value of a sort config variable
+ * @param ch Config handle
+ * @retval num Value of the variable
+ */
+short cc_sort(struct ConfigHandle *ch)
+{
+  return (short) cc_value(ch);
+}
+
+/**
+ * cc_string - Get the cached value of a string config variable
+ * @param ch Config handle
+ * @retval ptr Value of the variable
+ */
+const char *cc_string(struct ConfigHandle *ch)
+{
+  return (const char *) cc_value(ch);
+}
+
 /**
  * config_cache_cleanup - Cleanup the cache of charset config variables
  */
@@ -152,5 +250,13 @@ void config_cache_cleanup(void)
   CachedCharset = NULL;
   CachedMaildirFieldDelimiter = NULL;
 
+  struct ConfigHandle **chp = NULL;
+  ARRAY_FOREACH(chp, &Handles)
+  {
+    (*chp)->value = 0;
+    (*chp)->active = false;
+  }
+  ARRAY_FREE(&Handles);
+
   CacheActive = false;
 }
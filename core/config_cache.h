@@ -24,10 +24,38 @@
 #ifndef MUTT_CORE_CONFIG_CACHE_H
 #define MUTT_CORE_CONFIG_CACHE_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+struct MbTable;
+
+/**
+ * struct ConfigHandle - A config variable that's looked up once
+ *
+ * Declare a handle with CONFIG_HANDLE() and read it with a typed accessor,
+ * e.g. cc_bool().  The first read looks up the variable in NeoMutt->sub.
+ * After that, an observer keeps the value current.
+ */
+struct ConfigHandle
+{
+  const char *name; ///< Name of the config variable
+  intptr_t value;   ///< Native value of the config variable
+  bool active;      ///< Has the variable been looked up?
+};
+
+#define CONFIG_HANDLE(NAME) { NAME, 0, false }
+
 const struct Slist *cc_assumed_charset        (void);
 const char *        cc_charset                (void);
 const char *        cc_maildir_field_delimiter(void);
 
+bool                  cc_bool   (struct ConfigHandle *ch);
+unsigned char         cc_enum   (struct ConfigHandle *ch);
+const struct MbTable *cc_mbtable(struct ConfigHandle *ch);
+short                 cc_number (struct ConfigHandle *ch);
+short                 cc_sort   (struct ConfigHandle *ch);
+const char *          cc_string (struct ConfigHandle *ch);
+
 void config_cache_cleanup(void);
 
 #endif /* MUTT_CORE_CONFIG_CACHE_H */
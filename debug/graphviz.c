@@ -1685,6 +1685,7 @@ void dot_pattern(FILE *fp, struct Pattern *pat, struct ListHead *links)
   ADD_BOOL(dynamic);
   ADD_BOOL(sendmode);
   ADD_BOOL(is_multi);
+  ADD_BOOL(server_eval);
 #undef ADD_BOOL
   dot_type_string(fp, "flags", buf_is_empty(buf) ? "[NONE]" : buf_string(buf), true);
 
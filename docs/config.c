@@ -1887,6 +1887,17 @@
 ** mileage may vary.
 */
 
+{ "imap_connection_pool", DT_NUMBER, 0 },
+/*
+** .pp
+** The number of extra connections NeoMutt may open to each IMAP account
+** for background work, such as checking other mailboxes for new mail.
+** The main connection is then kept for the mailbox you are reading, so
+** it isn't held up waiting for the server to answer.
+** .pp
+** When \fIunset\fP (0), all the work is done using a single connection.
+*/
+
 #ifdef USE_ZLIB
 { "imap_deflate", DT_BOOL, true },
 /*
@@ -1916,6 +1927,9 @@
 ** disconnect when opening the mailbox, by sending a FETCH per set
 ** of this many headers, instead of a single FETCH for all new
 ** headers.
+** .pp
+** Up to $$imap_pipeline_depth of these requests are sent at once, so
+** that small chunks don't cost a network round trip each.
 */
 
 { "imap_headers", DT_STRING, 0 },
@@ -1971,6 +1985,18 @@
 ** This variable defaults to the value of $$imap_user.
 */
 
+{ "imap_notify", DT_BOOL, false },
+/*
+** .pp
+** When \fIset\fP, NeoMutt will use the NOTIFY extension (RFC5465), if
+** advertised by the server.  The server reports when messages arrive in, or
+** are removed from, any of your personal mailboxes.  NeoMutt then only
+** sends a STATUS command for the mailboxes that have changed, instead of
+** polling every mailbox.
+** .pp
+** Mailboxes outside your personal namespace are still polled.
+*/
+
 { "imap_oauth_refresh_command", D_STRING_COMMAND, 0 },
 /*
 ** .pp
@@ -2020,6 +2046,10 @@
 ** more responsive. But not all servers correctly handle pipelined commands,
 ** so if you have problems you might want to try setting this variable to 0.
 ** .pp
+** This is the upper limit. Each connection starts with a few commands in
+** flight and allows more as they complete, backing off if the server's
+** responses slow down.
+** .pp
 ** \fBNote:\fP Changes to this variable have no effect on open connections.
 */
 
@@ -2032,6 +2062,18 @@
 ** to 0 to disable timing out.
 */
 
+{ "imap_prefetch", DT_NUMBER, 0 },
+/*
+** .pp
+** When this variable is greater than 0, opening a message also asks the
+** server for up to this many of the messages that follow it in the index.
+** They are downloaded in the background into the message cache, so that
+** reading the next message doesn't wait for the network.
+** .pp
+** Messages that are already cached are skipped and the messages are not
+** marked as read.  This requires $$message_cache_dir to be set.
+*/
+
 { "imap_qresync", DT_BOOL, false },
 /*
 ** .pp
@@ -2511,7 +2553,40 @@
 ** remote message only once and can perform regular expression searches
 ** as fast as for local folders.
 ** .pp
-** Also see the $$message_cache_clean variable.
+** Also see the $$message_cache_clean and $$message_cache_size variables.
+*/
+
+{ "message_cache_shared", DT_BOOL, false },
+/*
+** .pp
+** When \fIset\fP, messages in the IMAP message cache are also linked into
+** a store shared by the mailboxes of an account, keyed by their Message-ID
+** and size.  A message that appears in several mailboxes, e.g. labels on
+** Gmail, or after a copy, is then only downloaded and stored once.
+** .pp
+** Before a shared copy is used, its Message-ID, From, Date and Subject
+** headers are checked against the message's.  If they differ, the message
+** is downloaded again.
+** .pp
+** This requires a filesystem that supports hard links.  Messages with no
+** Message-ID aren't shared, nor are messages whose size the server hasn't
+** sent this session, e.g. after a QRESYNC resync.  Shared messages that no
+** mailbox uses any more are removed when the cache is trimmed, see
+** $$message_cache_size, or cleaned, see $$message_cache_clean.
+*/
+
+{ "message_cache_size", DT_LONG, 0 },
+/*
+** .pp
+** This variable limits the total size, in bytes, of the message caches in
+** $$message_cache_dir.  When the limit is exceeded, the messages that were
+** used least recently are removed, whichever mailbox they belong to.
+** .pp
+** Only the caches of mailboxes that NeoMutt has added messages to, during
+** this session, are counted.  The time a message was last used is saved as
+** its file's modification time when NeoMutt exits.
+** .pp
+** A value of zero means the cache has no limit.
 */
 
 { "message_format", DT_STRING, "%s" },
@@ -112,6 +112,7 @@ struct Email
   const struct AttrColor *attr_color; ///< Color-pair to use when displaying in the index
   int score;                   ///< Message score
   int vnum;                    ///< Virtual message number
+  unsigned int changes;        ///< Incremented when the flags, tags or envelope change
   short attach_total;          ///< Number of qualifying attachments in message, if attach_valid
   short recipient;             ///< User_is_recipient()'s return value, cached
 
@@ -37,18 +37,18 @@ struct HashTable *AutoSubscribeCache = NULL;
 ///< List of header patterns to ignore
 struct ListHead Ignore = STAILQ_HEAD_INITIALIZER(Ignore);
 ///< List of regexes to match mailing lists
-struct RegexList MailLists = STAILQ_HEAD_INITIALIZER(MailLists);
+struct RegexList MailLists = REGEXLIST_INITIALIZER(MailLists);
 ///< List of permitted fields in a mailto: url
 struct ListHead MailToAllow = STAILQ_HEAD_INITIALIZER(MailToAllow);
 ///< List of regexes to identify non-spam emails
-struct RegexList NoSpamList = STAILQ_HEAD_INITIALIZER(NoSpamList);
+struct RegexList NoSpamList = REGEXLIST_INITIALIZER(NoSpamList);
 ///< List of regexes and patterns to match spam emails
 struct ReplaceList SpamList = STAILQ_HEAD_INITIALIZER(SpamList);
 ///< List of regexes to match subscribed mailing lists
-struct RegexList SubscribedLists = STAILQ_HEAD_INITIALIZER(SubscribedLists);
+struct RegexList SubscribedLists = REGEXLIST_INITIALIZER(SubscribedLists);
 ///< List of header patterns to unignore (see)
 struct ListHead UnIgnore = STAILQ_HEAD_INITIALIZER(UnIgnore);
 ///< List of regexes to exclude false matches in MailLists
-struct RegexList UnMailLists = STAILQ_HEAD_INITIALIZER(UnMailLists);
+struct RegexList UnMailLists = REGEXLIST_INITIALIZER(UnMailLists);
 ///< List of regexes to exclude false matches in SubscribedLists
-struct RegexList UnSubscribedLists = STAILQ_HEAD_INITIALIZER(UnSubscribedLists);
+struct RegexList UnSubscribedLists = REGEXLIST_INITIALIZER(UnSubscribedLists);
@@ -116,6 +116,9 @@ int expando_render(const struct Expando *exp, const struct ExpandoRenderData *rd
   if (max_cols == -1)
     max_cols = 8192;
 
+  if (exp->node->rdata != rdata)
+    node_tree_compile(exp->node, rdata);
+
   return node_render(exp->node, rdata, buf, max_cols, data, flags);
 }
 
@@ -35,6 +35,7 @@
 #include "helpers.h"
 #include "definition.h"
 #include "mutt_thread.h"
+#include "node.h"
 #include "render.h"
 
 /**
@@ -85,6 +86,40 @@ const struct ExpandoRenderData *find_get_string(const struct ExpandoRenderData *
   return NULL;
 }
 
+/**
+ * node_get_number - Get the get_number() callback function for a Node
+ * @param node  ExpandoNode
+ * @param rdata Render data to search
+ * @retval ptr Matching Render data
+ *
+ * If the Node has been compiled with this Render data, no search is needed.
+ */
+const struct ExpandoRenderData *node_get_number(const struct ExpandoNode *node,
+                                                const struct ExpandoRenderData *rdata)
+{
+  if (node->rdata == rdata)
+    return node->rd_number;
+
+  return find_get_number(rdata, node->did, node->uid);
+}
+
+/**
+ * node_get_string - Get the get_string() callback function for a Node
+ * @param node  ExpandoNode
+ * @param rdata Render data to search
+ * @retval ptr Matching Render data
+ *
+ * If the Node has been compiled with this Render data, no search is needed.
+ */
+const struct ExpandoRenderData *node_get_string(const struct ExpandoNode *node,
+                                                const struct ExpandoRenderData *rdata)
+{
+  if (node->rdata == rdata)
+    return node->rd_string;
+
+  return find_get_string(rdata, node->did, node->uid);
+}
+
 /**
  * skip_until_ch - Search a string for a terminator character
  * @param start      Start of string
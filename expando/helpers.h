@@ -26,6 +26,7 @@
 
 struct Buffer;
 struct ExpandoDefinition;
+struct ExpandoNode;
 struct ExpandoRenderData;
 
 const char *skip_classic_expando      (const char *str, const struct ExpandoDefinition *defs);
@@ -34,6 +35,8 @@ const char *skip_until_classic_expando(const char *start);
 
 const struct ExpandoRenderData *find_get_number(const struct ExpandoRenderData *rdata, int did, int uid);
 const struct ExpandoRenderData *find_get_string(const struct ExpandoRenderData *rdata, int did, int uid);
+const struct ExpandoRenderData *node_get_number(const struct ExpandoNode *node, const struct ExpandoRenderData *rdata);
+const struct ExpandoRenderData *node_get_string(const struct ExpandoNode *node, const struct ExpandoRenderData *rdata);
 
 void buf_lower_special(struct Buffer *buf);
 
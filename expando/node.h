@@ -82,6 +82,11 @@ struct ExpandoNode
   void *ndata;                           ///< Private node data
   void (*ndata_free)(void **ptr);        ///< Function to free the private node data
 
+  const struct ExpandoRenderData *rdata;     ///< Render data the callbacks were resolved from
+  const struct ExpandoRenderData *rd_number; ///< Resolved get_number() callback, or NULL
+  const struct ExpandoRenderData *rd_string; ///< Resolved get_string() callback, or NULL
+  int                             text_cols; ///< Width of plain ASCII Text, -1 if it needs formatting
+
   /**
    * @defgroup expando_render Expando Render API
    *
@@ -112,14 +112,14 @@ int node_condbool_render(const struct ExpandoNode *node,
 {
   ASSERT(node->type == ENT_CONDBOOL);
 
-  const struct ExpandoRenderData *rd_match = find_get_number(rdata, node->did, node->uid);
+  const struct ExpandoRenderData *rd_match = node_get_number(node, rdata);
   if (rd_match)
   {
     const long num = rd_match->get_number(node, data, flags);
     return (num != 0); // bool-ify
   }
 
-  rd_match = find_get_string(rdata, node->did, node->uid);
+  rd_match = node_get_string(node, rdata);
   if (rd_match)
   {
     struct Buffer *buf_str = buf_pool_get();
@@ -45,6 +45,15 @@ static int node_text_render(const struct ExpandoNode *node,
   ASSERT(node->type == ENT_TEXT);
 
   const int num_bytes = node->end - node->start;
+
+  // Compiled plain text can be copied verbatim
+  if (rdata && (node->rdata == rdata) && (node->text_cols >= 0) &&
+      (node->text_cols <= max_cols))
+  {
+    buf_addstr_n(buf, node->start, num_bytes);
+    return node->text_cols;
+  }
+
   return format_string(buf, 0, max_cols, JUSTIFY_LEFT, ' ', node->start, num_bytes, false);
 }
 
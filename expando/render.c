@@ -29,9 +29,58 @@
  */
 
 #include "config.h"
+#include <stddef.h>
+#include "mutt/lib.h"
 #include "render.h"
+#include "helpers.h"
 #include "node.h"
 
+/**
+ * text_cols - Measure some plain text
+ * @param start Start of text
+ * @param end   End of text
+ * @retval num Screen width of the text
+ * @retval -1  Text isn't printable ASCII
+ *
+ * Printable ASCII text can be copied verbatim, without formatting.
+ */
+static int text_cols(const char *start, const char *end)
+{
+  for (const char *p = start; p < end; p++)
+  {
+    if ((*p < ' ') || (*p > '~'))
+      return -1;
+  }
+
+  return end - start;
+}
+
+/**
+ * node_tree_compile - Prepare a tree of ExpandoNodes for rendering
+ * @param node  Root of tree
+ * @param rdata Expando Render data
+ *
+ * Each node remembers which entries of the Render data it uses, so that
+ * rendering doesn't need to search for them again.  Plain text is measured
+ * once, here, rather than on every render.
+ */
+void node_tree_compile(struct ExpandoNode *node, const struct ExpandoRenderData *rdata)
+{
+  for (; node; node = node->next)
+  {
+    node->rdata = rdata;
+    node->rd_number = find_get_number(rdata, node->did, node->uid);
+    node->rd_string = find_get_string(rdata, node->did, node->uid);
+    node->text_cols = (node->type == ENT_TEXT) ? text_cols(node->start, node->end) : -1;
+
+    struct ExpandoNode **enp = NULL;
+    ARRAY_FOREACH(enp, &node->children)
+    {
+      node_tree_compile(*enp, rdata);
+    }
+  }
+}
+
 /**
  * node_render - Render a tree of ExpandoNodes into a string
  * @param node     Root of tree
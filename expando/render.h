@@ -82,5 +82,6 @@ struct ExpandoRenderData
 int node_render(const struct ExpandoNode *node,
                      const struct ExpandoRenderData *rdata, struct Buffer *buf,
                      int max_cols, void *data, MuttFormatFlags flags);
+void node_tree_compile(struct ExpandoNode *node, const struct ExpandoRenderData *rdata);
 
 #endif /* MUTT_EXPANDO_RENDER_H */
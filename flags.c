@@ -336,6 +336,7 @@ void mutt_set_flag(struct Mailbox *m, struct Email *e, enum MessageType flag,
 
   if (update)
   {
+    e->changes++;
     mutt_set_header_color(m, e);
     struct EventMailbox ev_m = { m };
     notify_send(m->notify, NT_MAILBOX, NT_MAILBOX_CHANGE, &ev_m);
@@ -454,7 +454,7 @@ static unsigned int generate_hcachever(void)
 
   /* Mix in user's nospam list */
   struct RegexNode *np = NULL;
-  STAILQ_FOREACH(np, &NoSpamList, entries)
+  STAILQ_FOREACH(np, &NoSpamList.head, entries)
   {
     mutt_md5_process(np->regex->pattern, &md5ctx);
   }
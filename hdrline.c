@@ -62,6 +62,19 @@
 #include "notmuch/lib.h"
 #endif
 
+/// Cached value of $crypt_chars
+static struct ConfigHandle CachedCryptChars = CONFIG_HANDLE("crypt_chars");
+/// Cached value of $date_format
+static struct ConfigHandle CachedDateFormat = CONFIG_HANDLE("date_format");
+/// Cached value of $flag_chars
+static struct ConfigHandle CachedFlagChars = CONFIG_HANDLE("flag_chars");
+/// Cached value of $from_chars
+static struct ConfigHandle CachedFromChars = CONFIG_HANDLE("from_chars");
+/// Cached value of $save_address
+static struct ConfigHandle CachedSaveAddress = CONFIG_HANDLE("save_address");
+/// Cached value of $to_chars
+static struct ConfigHandle CachedToChars = CONFIG_HANDLE("to_chars");
+
 const struct ExpandoRenderData IndexRenderData[];
 
 /**
@@ -107,7 +120,7 @@ static const char *make_from_prefix(enum FieldType disp)
     [DISP_FROM] = "",  [DISP_PLAIN] = "",
   };
 
-  const struct MbTable *c_from_chars = cs_subset_mbtable(NeoMutt->sub, "from_chars");
+  const struct MbTable *c_from_chars = cc_mbtable(&CachedFromChars);
 
   if (!c_from_chars || !c_from_chars->chars || (c_from_chars->len == 0))
     return long_prefixes[disp];
@@ -682,7 +695,7 @@ void index_d(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
   if (!e)
     return;
 
-  const char *c_date_format = cs_subset_string(NeoMutt->sub, "date_format");
+  const char *c_date_format = cc_string(&CachedDateFormat);
   const char *cp = NONULL(c_date_format);
 
   index_email_date(node, e, SENT_SENDER, flags, buf, cp, strlen(cp));
@@ -699,7 +712,7 @@ void index_D(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
   if (!e)
     return;
 
-  const char *c_date_format = cs_subset_string(NeoMutt->sub, "date_format");
+  const char *c_date_format = cc_string(&CachedDateFormat);
   const char *cp = NONULL(c_date_format);
 
   index_email_date(node, e, SENT_LOCAL, flags, buf, cp, strlen(cp));
@@ -1113,7 +1126,7 @@ void index_O(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
   char *p = NULL;
 
   make_from_addr(e->env, tmp, sizeof(tmp), true);
-  const bool c_save_address = cs_subset_bool(NeoMutt->sub, "save_address");
+  const bool c_save_address = cc_bool(&CachedSaveAddress);
   if (!c_save_address && (p = strpbrk(tmp, "%@")))
   {
     *p = '\0';
@@ -1213,7 +1226,7 @@ void index_S(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
   if (!e)
     return;
 
-  const struct MbTable *c_flag_chars = cs_subset_mbtable(NeoMutt->sub, "flag_chars");
+  const struct MbTable *c_flag_chars = cc_mbtable(&CachedFlagChars);
   const int msg_in_pager = hfi->msg_in_pager;
 
   const char *wch = NULL;
@@ -1283,7 +1296,7 @@ void index_T(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
   if (!e)
     return;
 
-  const struct MbTable *c_to_chars = cs_subset_mbtable(NeoMutt->sub, "to_chars");
+  const struct MbTable *c_to_chars = cc_mbtable(&CachedToChars);
 
   int i;
   const char *s = (c_to_chars && ((i = user_is_recipient(e))) < c_to_chars->len) ?
@@ -1511,7 +1524,7 @@ void index_zc(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
   if (!e)
     return;
 
-  const struct MbTable *c_crypt_chars = cs_subset_mbtable(NeoMutt->sub, "crypt_chars");
+  const struct MbTable *c_crypt_chars = cc_mbtable(&CachedCryptChars);
 
   const char *ch = NULL;
   if ((WithCrypto != 0) && (e->security & SEC_GOODSIGN))
@@ -1552,7 +1565,7 @@ void index_zs(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
     return;
 
   const bool threads = mutt_using_threads();
-  const struct MbTable *c_flag_chars = cs_subset_mbtable(NeoMutt->sub, "flag_chars");
+  const struct MbTable *c_flag_chars = cc_mbtable(&CachedFlagChars);
   const int msg_in_pager = hfi->msg_in_pager;
 
   const char *ch = NULL;
@@ -1611,8 +1624,8 @@ void index_zt(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
   if (!e)
     return;
 
-  const struct MbTable *c_flag_chars = cs_subset_mbtable(NeoMutt->sub, "flag_chars");
-  const struct MbTable *c_to_chars = cs_subset_mbtable(NeoMutt->sub, "to_chars");
+  const struct MbTable *c_flag_chars = cc_mbtable(&CachedFlagChars);
+  const struct MbTable *c_to_chars = cc_mbtable(&CachedToChars);
 
   const char *ch = NULL;
   if (e->tagged)
@@ -1646,9 +1659,9 @@ void index_Z(const struct ExpandoNode *node, void *data, MuttFormatFlags flags,
 
   const int msg_in_pager = hfi->msg_in_pager;
 
-  const struct MbTable *c_crypt_chars = cs_subset_mbtable(NeoMutt->sub, "crypt_chars");
-  const struct MbTable *c_flag_chars = cs_subset_mbtable(NeoMutt->sub, "flag_chars");
-  const struct MbTable *c_to_chars = cs_subset_mbtable(NeoMutt->sub, "to_chars");
+  const struct MbTable *c_crypt_chars = cc_mbtable(&CachedCryptChars);
+  const struct MbTable *c_flag_chars = cc_mbtable(&CachedFlagChars);
+  const struct MbTable *c_to_chars = cc_mbtable(&CachedToChars);
   const bool threads = mutt_using_threads();
 
   const char *first = NULL;
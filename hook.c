@@ -67,18 +67,58 @@ extern const struct ExpandoDefinition IndexFormatDef[];
 struct Hook
 {
   HookFlags type;              ///< Hook type
+  HookFlags cmd_type;          ///< Flags of the command that created the Hook, e.g. fcc-save-hook
   struct Regex regex;          ///< Regular expression
   char *command;               ///< Filename, command or pattern to execute
   char *source_file;           ///< Used for relative-directory source
   struct PatternList *pattern; ///< Used for fcc,save,send-hook
   struct Expando *expando;     ///< Used for format hooks
   TAILQ_ENTRY(Hook) entries;   ///< Linked list
+  TAILQ_ENTRY(Hook) type_entries; ///< Linked list of Hooks of the same type
 };
 TAILQ_HEAD(HookList, Hook);
 
 /// All simple hooks, e.g. MUTT_FOLDER_HOOK
 static struct HookList Hooks = TAILQ_HEAD_INITIALIZER(Hooks);
 
+/// Number of hook types, one for each bit below #MUTT_GLOBAL_HOOK
+#define HOOK_NUM_TYPES 19
+
+/// All simple hooks, grouped by type, linked by Hook.type_entries
+static struct HookList HooksByType[HOOK_NUM_TYPES];
+
+/// Have the lists in #HooksByType been initialised?
+static bool HooksByTypeInit = false;
+
+/// Hook types that allow several commands with the same pattern
+#define MUTT_HOOK_MULTI_CMD                                                    \
+  (MUTT_FOLDER_HOOK | MUTT_SEND_HOOK | MUTT_SEND2_HOOK | MUTT_MESSAGE_HOOK |     \
+   MUTT_ACCOUNT_HOOK | MUTT_REPLY_HOOK | MUTT_CRYPT_HOOK | MUTT_TIMEOUT_HOOK |   \
+   MUTT_STARTUP_HOOK | MUTT_SHUTDOWN_HOOK)
+
+/// Simple hooks keyed by type and pattern, to find duplicates quickly
+static struct HashTable *HookPatterns = NULL;
+
+/// Simple hooks keyed by command, to find duplicate global hooks quickly
+static struct HashTable *HookCmds = NULL;
+
+/// Incremented whenever a simple hook is added or deleted
+static unsigned int HookGeneration = 0;
+
+/**
+ * struct FolderHookMatch - Cached folder-hook results for one mailbox
+ *
+ * Each entry in matches corresponds to a folder-hook, in order.
+ */
+struct FolderHookMatch
+{
+  unsigned int generation;             ///< Value of #HookGeneration when the matches were found
+  ARRAY_HEAD(, unsigned char) matches; ///< 0 no match, 1 path matched, 2 desc matched
+};
+
+/// Cache of folder-hook matches, keyed by mailbox path and description
+static struct HashTable *FolderHookCache = NULL;
+
 /// All Index Format hooks
 static struct HashTable *IdxFmtHooks = NULL;
 
@@ -118,6 +158,161 @@ static struct Hook *hook_new(void)
   return mutt_mem_calloc(1, sizeof(struct Hook));
 }
 
+/**
+ * hook_type_list - Get the list of simple hooks of one type
+ * @param type Hook type, see #HookFlags
+ * @retval ptr List of Hooks, linked by Hook.type_entries
+ */
+static struct HookList *hook_type_list(HookFlags type)
+{
+  if (!HooksByTypeInit)
+  {
+    for (int i = 0; i < HOOK_NUM_TYPES; i++)
+      TAILQ_INIT(&HooksByType[i]);
+    HooksByTypeInit = true;
+  }
+
+  for (int i = 0; i < HOOK_NUM_TYPES; i++)
+  {
+    if (type & (1U << i))
+      return &HooksByType[i];
+  }
+
+  ASSERT(false);
+  return &HooksByType[0];
+}
+
+/**
+ * hook_pattern_key - Create a key for #HookPatterns
+ * @param key      Buffer for the result
+ * @param type     Hook type, see #HookFlags
+ * @param cmd_type Flags of the hook command, see #HookFlags
+ * @param pat_not  True if the pattern is inverted
+ * @param pattern  Hook pattern
+ * @param cmd      Hook command
+ *
+ * Hooks that allow several commands per pattern include the command in the
+ * key, so each key is unique.
+ */
+static void hook_pattern_key(struct Buffer *key, HookFlags type, HookFlags cmd_type,
+                             bool pat_not, const char *pattern, const char *cmd)
+{
+  buf_printf(key, "%u:%u:%c:%s", (unsigned int) type, (unsigned int) cmd_type,
+             pat_not ? '!' : '=', NONULL(pattern));
+  if (cmd_type & MUTT_HOOK_MULTI_CMD)
+    buf_add_printf(key, "\n%s", NONULL(cmd));
+}
+
+/**
+ * hook_index_add - Add a Hook to #HookPatterns and #HookCmds
+ * @param h Hook to add
+ */
+static void hook_index_add(struct Hook *h)
+{
+  if (!HookPatterns)
+  {
+    HookPatterns = mutt_hash_new(1031, MUTT_HASH_STRDUP_KEYS);
+    HookCmds = mutt_hash_new(1031, MUTT_HASH_STRDUP_KEYS | MUTT_HASH_ALLOW_DUPS);
+  }
+
+  mutt_hash_insert(HookCmds, h->command, h);
+
+  if (h->type & MUTT_GLOBAL_HOOK)
+    return;
+
+  struct Buffer *key = buf_pool_get();
+  hook_pattern_key(key, h->type, h->cmd_type, h->regex.pat_not, h->regex.pattern, h->command);
+  mutt_hash_insert(HookPatterns, buf_string(key), h);
+  buf_pool_release(&key);
+}
+
+/**
+ * hook_index_delete - Remove a Hook from #HookPatterns and #HookCmds
+ * @param h Hook to remove
+ */
+static void hook_index_delete(struct Hook *h)
+{
+  mutt_hash_delete(HookCmds, h->command, h);
+
+  if (h->type & MUTT_GLOBAL_HOOK)
+    return;
+
+  struct Buffer *key = buf_pool_get();
+  hook_pattern_key(key, h->type, h->cmd_type, h->regex.pat_not, h->regex.pattern, h->command);
+  mutt_hash_delete(HookPatterns, buf_string(key), h);
+  buf_pool_release(&key);
+}
+
+/**
+ * folder_hook_match_free - Free a FolderHookMatch - Implements ::hash_hdata_free_t - @ingroup hash_hdata_free_api
+ */
+static void folder_hook_match_free(int type, void *obj, intptr_t data)
+{
+  struct FolderHookMatch *fhm = obj;
+
+  ARRAY_FREE(&fhm->matches);
+  FREE(&fhm);
+}
+
+/**
+ * folder_hook_test - Does a folder-hook match a mailbox?
+ * @param hook Folder hook
+ * @param path Mailbox path
+ * @param desc Mailbox description
+ * @retval 0 No match
+ * @retval 1 The path matched
+ * @retval 2 The description matched
+ */
+static unsigned char folder_hook_test(const struct Hook *hook, const char *path,
+                                      const char *desc)
+{
+  if (mutt_regex_match(&hook->regex, path))
+    return 1;
+  if (mutt_regex_match(&hook->regex, desc))
+    return 2;
+  return 0;
+}
+
+/**
+ * folder_hook_matches - Get the cached folder-hook results for a mailbox
+ * @param path Mailbox path
+ * @param desc Mailbox description
+ * @retval ptr Matches, valid for the current #HookGeneration
+ */
+static struct FolderHookMatch *folder_hook_matches(const char *path, const char *desc)
+{
+  if (!FolderHookCache)
+  {
+    FolderHookCache = mutt_hash_new(127, MUTT_HASH_STRDUP_KEYS);
+    mutt_hash_set_destructor(FolderHookCache, folder_hook_match_free, 0);
+  }
+
+  struct Buffer *key = buf_pool_get();
+  buf_printf(key, "%s\t%s", NONULL(path), NONULL(desc));
+
+  struct FolderHookMatch *fhm = mutt_hash_find(FolderHookCache, buf_string(key));
+  if (!fhm)
+  {
+    fhm = mutt_mem_calloc(1, sizeof(*fhm));
+    fhm->generation = HookGeneration - 1;
+    mutt_hash_insert(FolderHookCache, buf_string(key), fhm);
+  }
+  buf_pool_release(&key);
+
+  if (fhm->generation != HookGeneration)
+  {
+    ARRAY_SHRINK(&fhm->matches, ARRAY_SIZE(&fhm->matches));
+    struct Hook *hook = NULL;
+    TAILQ_FOREACH(hook, hook_type_list(MUTT_FOLDER_HOOK), type_entries)
+    {
+      ARRAY_ADD(&fhm->matches, folder_hook_test(hook, path, desc));
+    }
+    fhm->generation = HookGeneration;
+  }
+
+  return fhm;
+}
+
 /**
  * mutt_parse_charset_iconv_hook - Parse 'charset-hook' and 'iconv-hook' commands - Implements Command::parse() - @ingroup command_parse
  */
@@ -159,6 +354,119 @@ done:
   return rc;
 }
 
+/**
+ * hook_add - Add a simple hook of a single type
+ * @param type     Hook type, one of #HookFlags, plus #MUTT_GLOBAL_HOOK
+ * @param cmd_type Flags of the hook command, see #HookFlags
+ * @param pat_not  True if the pattern is inverted
+ * @param pattern  Hook pattern
+ * @param cmd      Hook command
+ * @param err      Buffer for error messages
+ * @retval #CommandResult Result e.g. #MUTT_CMD_SUCCESS
+ */
+static enum CommandResult hook_add(HookFlags type, HookFlags cmd_type, bool pat_not,
+                                   const char *pattern, const char *cmd, struct Buffer *err)
+{
+  struct Hook *hook = NULL;
+  regex_t *rx = NULL;
+  struct PatternList *pat = NULL;
+
+  /* check to make sure that a matching hook doesn't already exist */
+  if (type & MUTT_GLOBAL_HOOK)
+  {
+    /* Ignore duplicate global hooks */
+    if (mutt_hash_find(HookCmds, cmd))
+      return MUTT_CMD_SUCCESS;
+  }
+  else
+  {
+    struct Buffer *key = buf_pool_get();
+    hook_pattern_key(key, type, cmd_type, pat_not, pattern, cmd);
+    hook = mutt_hash_find(HookPatterns, buf_string(key));
+    buf_pool_release(&key);
+
+    if (hook)
+    {
+      /* these hooks allow multiple commands with the same
+       * pattern, so if we've already seen this pattern/command pair, just
+       * ignore it instead of creating a duplicate */
+      if (cmd_type & MUTT_HOOK_MULTI_CMD)
+        return MUTT_CMD_SUCCESS;
+
+      /* other hooks only allow one command per pattern, so update the
+       * entry with the new command.  this currently does not change the
+       * order of execution of the hooks, which i think is desirable since
+       * a common action to perform is to change the default (.) entry
+       * based upon some other information. */
+      mutt_hash_delete(HookCmds, hook->command, hook);
+      FREE(&hook->command);
+      FREE(&hook->source_file);
+      hook->command = mutt_str_dup(cmd);
+      hook->source_file = mutt_get_sourced_cwd();
+      mutt_hash_insert(HookCmds, hook->command, hook);
+      if (hook->expando)
+      {
+        expando_free(&hook->expando);
+        hook->expando = expando_parse(cmd, IndexFormatDef, err);
+      }
+      return MUTT_CMD_SUCCESS;
+    }
+  }
+
+  if (cmd_type & (MUTT_SEND_HOOK | MUTT_SEND2_HOOK | MUTT_SAVE_HOOK |
+                  MUTT_FCC_HOOK | MUTT_MESSAGE_HOOK | MUTT_REPLY_HOOK))
+  {
+    PatternCompFlags comp_flags;
+
+    if (cmd_type & (MUTT_SEND2_HOOK))
+      comp_flags = MUTT_PC_SEND_MODE_SEARCH;
+    else if (cmd_type & (MUTT_SEND_HOOK | MUTT_FCC_HOOK))
+      comp_flags = MUTT_PC_NO_FLAGS;
+    else
+      comp_flags = MUTT_PC_FULL_MSG;
+
+    struct MailboxView *mv_cur = get_current_mailbox_view();
+    struct Menu *menu = get_current_menu();
+    pat = mutt_pattern_comp(mv_cur, menu, pattern, comp_flags, err);
+    if (!pat)
+      return MUTT_CMD_ERROR;
+  }
+  else if (~type & MUTT_GLOBAL_HOOK) /* NOT a global hook */
+  {
+    /* Hooks not allowing full patterns: Check syntax of regex */
+    rx = mutt_mem_calloc(1, sizeof(regex_t));
+    int rc2 = REG_COMP(rx, pattern, ((cmd_type & MUTT_CRYPT_HOOK) ? REG_ICASE : 0));
+    if (rc2 != 0)
+    {
+      regerror(rc2, rx, err->data, err->dsize);
+      FREE(&rx);
+      return MUTT_CMD_ERROR;
+    }
+  }
+
+  struct Expando *exp = NULL;
+  if (cmd_type & (MUTT_IDXFMTHOOK | MUTT_MBOX_HOOK | MUTT_SAVE_HOOK | MUTT_FCC_HOOK))
+    exp = expando_parse(cmd, IndexFormatDef, err);
+
+  hook = hook_new();
+  hook->type = type;
+  hook->cmd_type = cmd_type;
+  hook->command = mutt_str_dup(cmd);
+  hook->source_file = mutt_get_sourced_cwd();
+  hook->pattern = pat;
+  hook->regex.pattern = mutt_str_dup(pattern);
+  hook->regex.regex = rx;
+  hook->regex.pat_not = pat_not;
+  hook->expando = exp;
+
+  TAILQ_INSERT_TAIL(&Hooks, hook, entries);
+  TAILQ_INSERT_TAIL(hook_type_list(hook->type), hook, type_entries);
+  hook_index_add(hook);
+  HookGeneration++;
+  return MUTT_CMD_SUCCESS;
+
+}
+
 /**
  * mutt_parse_hook - Parse the 'hook' family of commands - Implements Command::parse() - @ingroup command_parse
  *
@@ -167,12 +475,9 @@ done:
 enum CommandResult mutt_parse_hook(struct Buffer *buf, struct Buffer *s,
                                    intptr_t data, struct Buffer *err)
 {
-  struct Hook *hook = NULL;
   int rc = MUTT_CMD_ERROR;
   bool pat_not = false;
   bool use_regex = true;
-  regex_t *rx = NULL;
-  struct PatternList *pat = NULL;
   const bool folder_or_mbox = (data & (MUTT_FOLDER_HOOK | MUTT_MBOX_HOOK));
 
   struct Buffer *cmd = buf_pool_get();
@@ -284,98 +589,19 @@ enum CommandResult mutt_parse_hook(struct Buffer *buf, struct Buffer *s,
     buf_expand_path(cmd);
   }
 
-  /* check to make sure that a matching hook doesn't already exist */
-  TAILQ_FOREACH(hook, &Hooks, entries)
-  {
-    if (data & MUTT_GLOBAL_HOOK)
-    {
-      /* Ignore duplicate global hooks */
-      if (mutt_str_equal(hook->command, buf_string(cmd)))
-      {
-        rc = MUTT_CMD_SUCCESS;
-        goto cleanup;
-      }
-    }
-    else if ((hook->type == data) && (hook->regex.pat_not == pat_not) &&
-             mutt_str_equal(buf_string(pattern), hook->regex.pattern))
-    {
-      if (data & (MUTT_FOLDER_HOOK | MUTT_SEND_HOOK | MUTT_SEND2_HOOK | MUTT_MESSAGE_HOOK |
-                  MUTT_ACCOUNT_HOOK | MUTT_REPLY_HOOK | MUTT_CRYPT_HOOK |
-                  MUTT_TIMEOUT_HOOK | MUTT_STARTUP_HOOK | MUTT_SHUTDOWN_HOOK))
-      {
-        /* these hooks allow multiple commands with the same
-         * pattern, so if we've already seen this pattern/command pair, just
-         * ignore it instead of creating a duplicate */
-        if (mutt_str_equal(hook->command, buf_string(cmd)))
-        {
-          rc = MUTT_CMD_SUCCESS;
-          goto cleanup;
-        }
-      }
-      else
-      {
-        /* other hooks only allow one command per pattern, so update the
-         * entry with the new command.  this currently does not change the
-         * order of execution of the hooks, which i think is desirable since
-         * a common action to perform is to change the default (.) entry
-         * based upon some other information. */
-        FREE(&hook->command);
-        hook->command = buf_strdup(cmd);
-        hook->source_file = mutt_get_sourced_cwd();
-        rc = MUTT_CMD_SUCCESS;
-        goto cleanup;
-      }
-    }
-  }
-
-  if (data & (MUTT_SEND_HOOK | MUTT_SEND2_HOOK | MUTT_SAVE_HOOK |
-              MUTT_FCC_HOOK | MUTT_MESSAGE_HOOK | MUTT_REPLY_HOOK))
+  /* Create one Hook for each type, e.g. fcc-save-hook creates an fcc-hook
+   * and a save-hook, so that each type's list holds all of its hooks */
+  for (int i = 0; i < HOOK_NUM_TYPES; i++)
   {
-    PatternCompFlags comp_flags;
-
-    if (data & (MUTT_SEND2_HOOK))
-      comp_flags = MUTT_PC_SEND_MODE_SEARCH;
-    else if (data & (MUTT_SEND_HOOK | MUTT_FCC_HOOK))
-      comp_flags = MUTT_PC_NO_FLAGS;
-    else
-      comp_flags = MUTT_PC_FULL_MSG;
+    if (!(data & (1U << i)))
+      continue;
 
-    struct MailboxView *mv_cur = get_current_mailbox_view();
-    struct Menu *menu = get_current_menu();
-    pat = mutt_pattern_comp(mv_cur, menu, buf_string(pattern), comp_flags, err);
-    if (!pat)
-      goto cleanup;
-  }
-  else if (~data & MUTT_GLOBAL_HOOK) /* NOT a global hook */
-  {
-    /* Hooks not allowing full patterns: Check syntax of regex */
-    rx = mutt_mem_calloc(1, sizeof(regex_t));
-    int rc2 = REG_COMP(rx, buf_string(pattern), ((data & MUTT_CRYPT_HOOK) ? REG_ICASE : 0));
-    if (rc2 != 0)
-    {
-      regerror(rc2, rx, err->data, err->dsize);
-      FREE(&rx);
-      goto cleanup;
-    }
+    rc = hook_add((1U << i) | (data & MUTT_GLOBAL_HOOK), data, pat_not,
+                  buf_string(pattern), buf_string(cmd), err);
+    if (rc != MUTT_CMD_SUCCESS)
+      break;
   }
 
-  struct Expando *exp = NULL;
-  if (data & (MUTT_IDXFMTHOOK | MUTT_MBOX_HOOK | MUTT_SAVE_HOOK | MUTT_FCC_HOOK))
-    exp = expando_parse(buf_string(cmd), IndexFormatDef, err);
-
-  hook = hook_new();
-  hook->type = data;
-  hook->command = buf_strdup(cmd);
-  hook->source_file = mutt_get_sourced_cwd();
-  hook->pattern = pat;
-  hook->regex.pattern = buf_strdup(pattern);
-  hook->regex.regex = rx;
-  hook->regex.pat_not = pat_not;
-  hook->expando = exp;
-
-  TAILQ_INSERT_TAIL(&Hooks, hook, entries);
-  rc = MUTT_CMD_SUCCESS;
-
 cleanup:
   buf_pool_release(&cmd);
   buf_pool_release(&pattern);
@@ -393,14 +619,24 @@ void mutt_delete_hooks(HookFlags type)
   struct Hook *h = NULL;
   struct Hook *tmp = NULL;
 
+  if (type == MUTT_HOOK_NO_FLAGS)
+  {
+    mutt_hash_free(&HookPatterns);
+    mutt_hash_free(&HookCmds);
+    mutt_hash_free(&FolderHookCache);
+  }
+
   TAILQ_FOREACH_SAFE(h, &Hooks, entries, tmp)
   {
-    if ((type == MUTT_HOOK_NO_FLAGS) || (type == h->type))
+    if ((type == MUTT_HOOK_NO_FLAGS) || (type == h->cmd_type))
     {
       TAILQ_REMOVE(&Hooks, h, entries);
+      TAILQ_REMOVE(hook_type_list(h->type), h, type_entries);
+      hook_index_delete(h);
       hook_free(&h);
     }
   }
+  HookGeneration++;
 }
 
 /**
@@ -518,6 +754,7 @@ static enum CommandResult mutt_parse_idxfmt_hook(struct Buffer *buf, struct Buff
 
   hook = hook_new();
   hook->type = MUTT_IDXFMTHOOK;
+  hook->cmd_type = MUTT_IDXFMTHOOK;
   hook->command = NULL;
   hook->source_file = mutt_get_sourced_cwd();
   hook->pattern = pat;
@@ -630,18 +867,28 @@ void mutt_folder_hook(const char *path, const char *desc)
 
   CurrentHookType = MUTT_FOLDER_HOOK;
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  struct FolderHookMatch *fhm = folder_hook_matches(path, desc);
+  const unsigned int generation = HookGeneration;
+  size_t idx = 0;
+
+  TAILQ_FOREACH(hook, hook_type_list(MUTT_FOLDER_HOOK), type_entries)
   {
-    if (!hook->command)
-      continue;
+    /* A hook's commands may create more hooks, so only trust the cache
+     * while the list is unchanged */
+    unsigned char result;
+    if ((HookGeneration == generation) && (idx < ARRAY_SIZE(&fhm->matches)))
+      result = *ARRAY_GET(&fhm->matches, idx);
+    else
+      result = folder_hook_test(hook, path, desc);
+    idx++;
 
-    if (!(hook->type & MUTT_FOLDER_HOOK))
+    if (!hook->command)
       continue;
 
     const char *match = NULL;
-    if (mutt_regex_match(&hook->regex, path))
+    if (result == 1)
       match = path;
-    else if (mutt_regex_match(&hook->regex, desc))
+    else if (result == 2)
       match = desc;
 
     if (match)
@@ -672,13 +919,10 @@ char *mutt_find_hook(HookFlags type, const char *pat)
 {
   struct Hook *tmp = NULL;
 
-  TAILQ_FOREACH(tmp, &Hooks, entries)
+  TAILQ_FOREACH(tmp, hook_type_list(type), type_entries)
   {
-    if (tmp->type & type)
-    {
-      if (mutt_regex_match(&tmp->regex, pat))
-        return tmp->command;
-    }
+    if (mutt_regex_match(&tmp->regex, pat))
+      return tmp->command;
   }
   return NULL;
 }
@@ -697,28 +941,25 @@ void mutt_message_hook(struct Mailbox *m, struct Email *e, HookFlags type)
 
   CurrentHookType = type;
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  TAILQ_FOREACH(hook, hook_type_list(type), type_entries)
   {
     if (!hook->command)
       continue;
 
-    if (hook->type & type)
+    if ((mutt_pattern_exec(SLIST_FIRST(hook->pattern), 0, m, e, &cache) > 0) ^
+        hook->regex.pat_not)
     {
-      if ((mutt_pattern_exec(SLIST_FIRST(hook->pattern), 0, m, e, &cache) > 0) ^
-          hook->regex.pat_not)
+      if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
       {
-        if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
-        {
-          mutt_error("%s", buf_string(err));
-          CurrentHookType = MUTT_HOOK_NO_FLAGS;
-          buf_pool_release(&err);
-
-          return;
-        }
-        /* Executing arbitrary commands could affect the pattern results,
-         * so the cache has to be wiped */
-        memset(&cache, 0, sizeof(cache));
+        mutt_error("%s", buf_string(err));
+        CurrentHookType = MUTT_HOOK_NO_FLAGS;
+        buf_pool_release(&err);
+
+        return;
       }
+      /* Executing arbitrary commands could affect the pattern results,
+       * so the cache has to be wiped */
+      memset(&cache, 0, sizeof(cache));
     }
   }
   buf_pool_release(&err);
@@ -741,21 +982,18 @@ static int addr_hook(struct Buffer *path, HookFlags type, struct Mailbox *m, str
   struct PatternCache cache = { 0 };
 
   /* determine if a matching hook exists */
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  TAILQ_FOREACH(hook, hook_type_list(type), type_entries)
   {
     if (!hook->command)
       continue;
 
-    if (hook->type & type)
+    if ((mutt_pattern_exec(SLIST_FIRST(hook->pattern), 0, m, e, &cache) > 0) ^
+        hook->regex.pat_not)
     {
-      if ((mutt_pattern_exec(SLIST_FIRST(hook->pattern), 0, m, e, &cache) > 0) ^
-          hook->regex.pat_not)
-      {
-        buf_alloc(path, PATH_MAX);
-        mutt_make_string(path, -1, hook->expando, m, -1, e, MUTT_FORMAT_PLAIN, NULL);
-        buf_fix_dptr(path);
-        return 0;
-      }
+      buf_alloc(path, PATH_MAX);
+      mutt_make_string(path, -1, hook->expando, m, -1, e, MUTT_FORMAT_PLAIN, NULL);
+      buf_fix_dptr(path);
+      return 0;
     }
   }
 
@@ -851,9 +1089,9 @@ static void list_hook(struct ListHead *matches, const char *match, HookFlags typ
 {
   struct Hook *tmp = NULL;
 
-  TAILQ_FOREACH(tmp, &Hooks, entries)
+  TAILQ_FOREACH(tmp, hook_type_list(type), type_entries)
   {
-    if ((tmp->type & type) && mutt_regex_match(&tmp->regex, match))
+    if (mutt_regex_match(&tmp->regex, match))
     {
       mutt_list_insert_tail(matches, mutt_str_dup(tmp->command));
     }
@@ -888,9 +1126,9 @@ void mutt_account_hook(const char *url)
   struct Hook *hook = NULL;
   struct Buffer *err = buf_pool_get();
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  TAILQ_FOREACH(hook, hook_type_list(MUTT_ACCOUNT_HOOK), type_entries)
   {
-    if (!(hook->command && (hook->type & MUTT_ACCOUNT_HOOK)))
+    if (!hook->command)
       continue;
 
     if (mutt_regex_match(&hook->regex, url))
@@ -926,9 +1164,9 @@ void mutt_timeout_hook(void)
   struct Hook *hook = NULL;
   struct Buffer *err = buf_pool_get();
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  TAILQ_FOREACH(hook, hook_type_list(MUTT_TIMEOUT_HOOK), type_entries)
   {
-    if (!(hook->command && (hook->type & MUTT_TIMEOUT_HOOK)))
+    if (!hook->command)
       continue;
 
     if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
@@ -958,9 +1196,9 @@ void mutt_startup_shutdown_hook(HookFlags type)
   struct Hook *hook = NULL;
   struct Buffer *err = buf_pool_get();
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  TAILQ_FOREACH(hook, hook_type_list(type), type_entries)
   {
-    if (!(hook->command && (hook->type & type)))
+    if (!hook->command)
       continue;
 
     if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
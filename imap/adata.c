@@ -34,6 +34,10 @@
 #include "conn/lib.h"
 #include "adata.h"
 #include "lib.h"
+#include "mutt_socket.h"
+
+/// Seconds to wait before retrying a pool connection that couldn't log in
+#define IMAP_POOL_RETRY 300
 
 /**
  * imap_timeout_observer - Notification that a timeout has occurred - Implements ::observer_t - @ingroup observer_api
@@ -63,6 +67,53 @@ static int imap_timeout_observer(struct NotifyCallback *nc)
   return 0;
 }
 
+/**
+ * pool_drain - Process the responses waiting on a pool connection
+ * @param pool Imap Account data of a pool connection
+ *
+ * Background commands aren't waited for.  Their responses are handled
+ * whenever they have arrived.
+ */
+static void pool_drain(struct ImapAccountData *pool)
+{
+  while ((pool->state >= IMAP_AUTHENTICATED) && (pool->nextcmd != pool->lastcmd) &&
+         (mutt_socket_poll(pool->conn, 0) > 0))
+  {
+    if (imap_cmd_step(pool) != IMAP_RES_CONTINUE)
+      break;
+  }
+}
+
+/**
+ * imap_pool_timeout_observer - Notification that a timeout has occurred - Implements ::observer_t - @ingroup observer_api
+ *
+ * Pool connections have no Mailbox to check, so they're kept alive with NOOP.
+ */
+static int imap_pool_timeout_observer(struct NotifyCallback *nc)
+{
+  if (nc->event_type != NT_TIMEOUT)
+    return 0;
+  if (!nc->global_data)
+    return -1;
+
+  struct ImapAccountData *pool = nc->global_data;
+
+  time_t now = mutt_date_now();
+  const short c_imap_keep_alive = cs_subset_number(NeoMutt->sub, "imap_keep_alive");
+
+  if ((pool->state >= IMAP_AUTHENTICATED) && (now >= (pool->lastread + c_imap_keep_alive)))
+  {
+    pool_drain(pool);
+    if (pool->nextcmd == pool->lastcmd)
+    {
+      mutt_debug(LL_DEBUG5, "imap pool keep alive\n");
+      imap_exec(pool, "NOOP", IMAP_CMD_POLL);
+    }
+  }
+
+  return 0;
+}
+
 /**
  * imap_adata_free - Free the private Account data - Implements Account::adata_free() - @ingroup account_adata_free
  */
@@ -74,6 +125,14 @@ void imap_adata_free(void **ptr)
   struct ImapAccountData *adata = *ptr;
 
   notify_observer_remove(NeoMutt->notify_timeout, imap_timeout_observer, adata);
+  notify_observer_remove(NeoMutt->notify_timeout, imap_pool_timeout_observer, adata);
+
+  struct ImapAccountData **ap = NULL;
+  ARRAY_FOREACH(ap, &adata->pool)
+  {
+    imap_adata_free((void **) ap);
+  }
+  ARRAY_FREE(&adata->pool);
 
   FREE(&adata->capstr);
   buf_dealloc(&adata->cmdbuf);
@@ -106,6 +165,7 @@ struct ImapAccountData *imap_adata_new(struct Account *a)
   const short c_imap_pipeline_depth = cs_subset_number(NeoMutt->sub, "imap_pipeline_depth");
   adata->cmdslots = c_imap_pipeline_depth + 2;
   adata->cmds = mutt_mem_calloc(adata->cmdslots, sizeof(*adata->cmds));
+  imap_cmd_window_reset(adata);
 
   if (++new_seqid > 'z')
     new_seqid = 'a';
@@ -126,3 +186,82 @@ struct ImapAccountData *imap_adata_get(struct Mailbox *m)
     return NULL;
   return m->account->adata;
 }
+
+/**
+ * imap_adata_pool_drain - Process the responses waiting on all pool connections
+ * @param adata Imap Account data of the main connection
+ */
+void imap_adata_pool_drain(struct ImapAccountData *adata)
+{
+  if (!adata)
+    return;
+
+  struct ImapAccountData **ap = NULL;
+  ARRAY_FOREACH(ap, &adata->pool)
+  {
+    pool_drain(*ap);
+  }
+}
+
+/**
+ * imap_adata_pool_get - Get a connection for background work
+ * @param adata Imap Account data of the main connection
+ * @retval ptr  Logged-in connection from the pool
+ * @retval NULL No pool connection is available, use the main connection
+ *
+ * The pool connections are opened on demand, up to `$imap_connection_pool`,
+ * and are used in turn.  They are never used to SELECT a mailbox.
+ */
+struct ImapAccountData *imap_adata_pool_get(struct ImapAccountData *adata)
+{
+  if (!adata || !adata->conn)
+    return NULL;
+
+  const short c_imap_connection_pool = cs_subset_number(NeoMutt->sub, "imap_connection_pool");
+  if (c_imap_connection_pool <= 0)
+    return NULL;
+
+  struct ImapAccountData *pool = NULL;
+  if (ARRAY_SIZE(&adata->pool) < c_imap_connection_pool)
+  {
+    pool = imap_adata_new(adata->account);
+    pool->conn = mutt_conn_new(&adata->conn->account);
+    if (!pool->conn)
+    {
+      imap_adata_free((void **) &pool);
+      return NULL;
+    }
+    notify_observer_remove(NeoMutt->notify_timeout, imap_timeout_observer, pool);
+    notify_observer_add(NeoMutt->notify_timeout, NT_TIMEOUT, imap_pool_timeout_observer, pool);
+    ARRAY_ADD(&adata->pool, pool);
+    adata->pool_next = ARRAY_SIZE(&adata->pool) - 1;
+  }
+
+  adata->pool_next %= ARRAY_SIZE(&adata->pool);
+  pool = *ARRAY_GET(&adata->pool, adata->pool_next);
+  adata->pool_next++;
+
+  /* A fatal error leaves the connection in limbo, because it has no Mailbox
+   * to reopen.  Reset it and log in again. */
+  if (pool->status == IMAP_FATAL)
+    imap_close_connection(pool);
+
+  if (pool->state < IMAP_AUTHENTICATED)
+  {
+    /* Don't make every STATUS wait for a connection that keeps failing */
+    const time_t now = mutt_date_now();
+    if (now < pool->pool_retry)
+      return NULL;
+
+    if (imap_login(pool) < 0)
+    {
+      mutt_debug(LL_DEBUG1, "Can't log in pool connection to %s\n", pool->conn->account.host);
+      pool->pool_retry = now + IMAP_POOL_RETRY;
+      return NULL;
+    }
+    pool->pool_retry = 0;
+  }
+
+  pool_drain(pool);
+  return pool;
+}
@@ -31,6 +31,8 @@
 struct Account;
 struct Mailbox;
 
+ARRAY_HEAD(ImapAccountDataArray, struct ImapAccountData *);
+
 /**
  * struct ImapAccountData - IMAP-specific Account data - @extends Account
  *
@@ -61,6 +63,7 @@ struct ImapAccountData
 
   bool unicode; ///< If true, we can send UTF-8, and the server will use UTF8 rather than mUTF7
   bool qresync; ///< true, if QRESYNC is successfully ENABLE'd
+  bool notify;  ///< true, if NOTIFY SET is active for the other mailboxes
 
   // if set, the response parser will store results for complicated commands here
   struct ImapList *cmdresult;
@@ -70,16 +73,26 @@ struct ImapAccountData
   int cmdslots;             ///< Size of the command queue
   int nextcmd;              ///< Next command to be sent
   int lastcmd;              ///< Last command in the queue
+  int cmdwindow;            ///< Number of commands allowed in flight
+  uint64_t rtt;             ///< Smoothed round trip time of commands, in milliseconds
+  uint64_t rtt_min;         ///< Fastest round trip time seen, in milliseconds
+  unsigned int cmd_failures; ///< Number of commands that have failed (NO or BAD)
   struct Buffer cmdbuf;
 
   char delim;                   ///< Path delimiter
   struct Mailbox *mailbox;      ///< Current selected mailbox
   struct Mailbox *prev_mailbox; ///< Previously selected mailbox
   struct Account *account;      ///< Parent Account
+
+  struct ImapAccountDataArray pool; ///< Extra connections for background work
+  int pool_next;                    ///< Next pool connection to use
+  time_t pool_retry;                ///< Pool connection: don't try to log in again until then
 };
 
 void                    imap_adata_free(void **ptr);
 struct ImapAccountData *imap_adata_get (struct Mailbox *m);
 struct ImapAccountData *imap_adata_new (struct Account *a);
+void                    imap_adata_pool_drain(struct ImapAccountData *adata);
+struct ImapAccountData *imap_adata_pool_get(struct ImapAccountData *adata);
 
 #endif /* MUTT_IMAP_ADATA_H */
@@ -87,6 +87,8 @@ static const char *const Capabilities[] = {
   "COMPRESS=DEFLATE",
   "X-GM-EXT-1",
   "ID",
+  "ESEARCH",
+  "NOTIFY",
   NULL,
 };
 
@@ -97,10 +99,96 @@ static const char *const Capabilities[] = {
  */
 static bool cmd_queue_full(struct ImapAccountData *adata)
 {
-  if (((adata->nextcmd + 1) % adata->cmdslots) == adata->lastcmd)
-    return true;
+  return imap_cmd_queue_space(adata) <= 0;
+}
+
+/**
+ * cmd_sample_rtt - Measure the round trip of a timed command
+ * @param adata Imap Account data
+ *
+ * This is called when a response line arrives.  If the oldest command in
+ * flight is being timed, its round trip ends here, at the first line of the
+ * response.  Transferring a large literal, or an IDLE waiting for new mail,
+ * isn't counted.
+ *
+ * If the round trips become much slower than the fastest one seen, then
+ * commands are queueing up at the server, or on the link, so the window is
+ * halved.  Otherwise it grows by one.
+ */
+static void cmd_sample_rtt(struct ImapAccountData *adata)
+{
+  if (adata->lastcmd == adata->nextcmd)
+    return;
+
+  struct ImapCommand *cmd = &adata->cmds[adata->lastcmd];
+  if ((cmd->state != IMAP_RES_NEW) || !cmd->timed || (cmd->sent == 0))
+    return;
+
+  const uint64_t rtt = mutt_date_now_ms() - cmd->sent;
+  cmd->timed = false;
+  cmd->sent = 0;
+
+  if ((adata->rtt_min == 0) || (rtt < adata->rtt_min))
+    adata->rtt_min = MAX(rtt, 1);
+  adata->rtt = (adata->rtt == 0) ? rtt : ((7 * adata->rtt) + rtt) / 8;
 
-  return false;
+  if ((adata->rtt > (4 * adata->rtt_min) + 50) && (adata->cmdwindow > 1))
+  {
+    adata->cmdwindow /= 2;
+    adata->rtt = 0;
+    mutt_debug(LL_DEBUG3, "IMAP pipeline shrunk to %d (rtt %llu ms, min %llu ms)\n",
+               adata->cmdwindow, (unsigned long long) rtt,
+               (unsigned long long) adata->rtt_min);
+  }
+  else if (adata->cmdwindow < adata->cmdslots - 1)
+  {
+    adata->cmdwindow++;
+  }
+}
+
+/**
+ * cmd_adapt_window - Adjust the number of commands allowed in flight
+ * @param adata Imap Account data
+ * @param cmd   Command that has just completed
+ *
+ * The window grows by one for every command that completes.  Timed commands
+ * have already adjusted it in cmd_sample_rtt().
+ *
+ * Only commands sent with nothing else in flight are timed.  The others
+ * would include the time spent waiting behind the earlier commands.
+ */
+static void cmd_adapt_window(struct ImapAccountData *adata, struct ImapCommand *cmd)
+{
+  if (cmd->sent == 0)
+    return;
+
+  if (adata->cmdwindow < adata->cmdslots - 1)
+    adata->cmdwindow++;
+}
+
+/**
+ * imap_cmd_queue_space - How many more commands can be queued?
+ * @param adata Imap Account data
+ * @retval num Number of commands that can be queued without waiting
+ */
+int imap_cmd_queue_space(struct ImapAccountData *adata)
+{
+  const int queued = (adata->nextcmd - adata->lastcmd + adata->cmdslots) % adata->cmdslots;
+  return MIN(adata->cmdwindow, adata->cmdslots - 1) - queued;
+}
+
+/**
+ * imap_cmd_window_reset - Reset the adaptive pipeline
+ * @param adata Imap Account data
+ *
+ * A new connection starts with a small window, which grows up to
+ * `$imap_pipeline_depth` as commands complete.
+ */
+void imap_cmd_window_reset(struct ImapAccountData *adata)
+{
+  adata->cmdwindow = MIN(4, adata->cmdslots - 1);
+  adata->rtt = 0;
+  adata->rtt_min = 0;
 }
 
 /**
@@ -127,6 +215,8 @@ static struct ImapCommand *cmd_new(struct ImapAccountData *adata)
     adata->seqno = 0;
 
   cmd->state = IMAP_RES_NEW;
+  cmd->sent = 0;
+  cmd->timed = false;
 
   return cmd;
 }
@@ -139,17 +229,32 @@ static struct ImapCommand *cmd_new(struct ImapAccountData *adata)
  * @retval  0 Success
  * @retval <0 Failure, e.g. #IMAP_RES_BAD
  *
- * If the queue is full, attempts to drain it.
+ * If the queue is full, the queued commands are sent and the oldest ones are
+ * waited for, until there's a free slot.
  */
 static int cmd_queue(struct ImapAccountData *adata, const char *cmdstr, ImapCmdFlags flags)
 {
   if (cmd_queue_full(adata))
   {
-    mutt_debug(LL_DEBUG3, "Draining IMAP command pipeline\n");
+    mutt_debug(LL_DEBUG3, "Waiting for a free slot in the IMAP command pipeline\n");
+
+    /* Send the queued commands, but only wait for the oldest to finish */
+    if (!buf_is_empty(&adata->cmdbuf) && (imap_cmd_start(adata, NULL) < 0))
+      return IMAP_RES_BAD;
+
+    const short c_imap_poll_timeout = cs_subset_number(NeoMutt->sub, "imap_poll_timeout");
+    if ((flags & IMAP_CMD_POLL) && (c_imap_poll_timeout > 0) &&
+        ((mutt_socket_poll(adata->conn, c_imap_poll_timeout)) == 0))
+    {
+      mutt_error(_("Connection to %s timed out"), adata->conn->account.host);
+      return IMAP_RES_BAD;
+    }
 
-    const int rc = imap_exec(adata, NULL, flags & IMAP_CMD_POLL);
+    int rc = IMAP_RES_CONTINUE;
+    while (cmd_queue_full(adata) && (rc == IMAP_RES_CONTINUE))
+      rc = imap_cmd_step(adata);
 
-    if (rc == IMAP_EXEC_ERROR)
+    if ((rc == IMAP_RES_NO) || (rc == IMAP_RES_BAD) || cmd_queue_full(adata))
       return IMAP_RES_BAD;
   }
 
@@ -224,6 +329,24 @@ static int cmd_start(struct ImapAccountData *adata, const char *cmdstr, ImapCmdF
                           (flags & IMAP_CMD_PASS) ? IMAP_LOG_PASS : IMAP_LOG_CMD);
   buf_reset(&adata->cmdbuf);
 
+  /* Stamp the commands just sent.  If none were already in flight, the first
+   * one's round trip isn't affected by queueing, so time it. */
+  const uint64_t now = mutt_date_now_ms();
+  bool busy = false;
+  for (int c = adata->lastcmd; c != adata->nextcmd; c = (c + 1) % adata->cmdslots)
+  {
+    struct ImapCommand *cmd = &adata->cmds[c];
+    if (cmd->state != IMAP_RES_NEW)
+      continue;
+
+    if (cmd->sent == 0)
+    {
+      cmd->sent = now;
+      cmd->timed = !busy;
+    }
+    busy = true;
+  }
+
   /* unidle when command queue is flushed */
   if (adata->state == IMAP_IDLE)
     adata->state = IMAP_SELECTED;
@@ -389,22 +512,43 @@ static void cmd_parse_vanished(struct ImapAccountData *adata, char *s)
   mutt_seqset_iterator_free(&iter);
 }
 
+/**
+ * fetch_set_flags - Apply the FLAGS of an unsolicited FETCH response
+ * @param adata Imap Account data
+ * @param e     Email
+ * @param flags String containing the FLAGS list
+ */
+static void fetch_set_flags(struct ImapAccountData *adata, struct Email *e, char *flags)
+{
+  struct ImapMboxData *mdata = imap_mdata_get(adata->mailbox);
+  bool server_changes = false;
+
+  imap_set_flags(adata->mailbox, e, flags, &server_changes);
+  if (server_changes)
+  {
+    /* If server flags could conflict with NeoMutt's flags, reopen the mailbox. */
+    if (e->changed)
+      mdata->reopen |= IMAP_EXPUNGE_PENDING;
+    else
+      mdata->check_status |= IMAP_FLAGS_PENDING;
+  }
+}
+
 /**
  * cmd_parse_fetch - Load fetch response into ImapAccountData
  * @param adata Imap Account data
  * @param s     String containing MSN of message to fetch
  *
- * Currently only handles unanticipated FETCH responses, and only FLAGS data.
- * We get these if another client has changed flags for a mailbox we've
- * selected.  Of course, a lot of code here duplicates code in message.c.
+ * Currently only handles unanticipated FETCH responses, FLAGS data and the
+ * bodies requested by `$imap_prefetch`.  We get FLAGS if another client has
+ * changed flags for a mailbox we've selected.  Of course, a lot of code here
+ * duplicates code in message.c.
  */
 static void cmd_parse_fetch(struct ImapAccountData *adata, char *s)
 {
-  unsigned int msn, uid;
+  unsigned int msn, uid, bytes;
   struct Email *e = NULL;
   char *flags = NULL;
-  int uid_checked = 0;
-  bool server_changes = false;
 
   struct ImapMboxData *mdata = imap_mdata_get(adata->mailbox);
 
@@ -448,8 +592,6 @@ static void cmd_parse_fetch(struct ImapAccountData *adata, char *s)
     if (plen != 0)
     {
       flags = s;
-      if (uid_checked)
-        break;
 
       s += plen;
       SKIPWS(s);
@@ -485,11 +627,31 @@ static void cmd_parse_fetch(struct ImapAccountData *adata, char *s)
         mutt_debug(LL_DEBUG1, "UID vs MSN mismatch.  Skipping update\n");
         return;
       }
-      uid_checked = 1;
-      if (flags)
-        break;
       s = imap_next_word(s);
     }
+    else if ((plen = mutt_istr_startswith(s, "BODY[]")))
+    {
+      s += plen;
+      SKIPWS(s);
+      if (imap_get_literal_count(s, &bytes) < 0)
+      {
+        mutt_debug(LL_DEBUG1, "bogus BODY[] response: %s\n", s);
+        return;
+      }
+
+      /* Reading the literal replaces adata->buf */
+      if (flags)
+        fetch_set_flags(adata, e, flags);
+      flags = NULL;
+
+      if (imap_cache_literal(adata->mailbox, e, bytes) < 0)
+        return;
+
+      /* pick up trailing line */
+      if (imap_cmd_step(adata) != IMAP_RES_CONTINUE)
+        return;
+      s = adata->buf;
+    }
     else if ((plen = mutt_istr_startswith(s, "MODSEQ")))
     {
       s += plen;
@@ -524,17 +686,7 @@ static void cmd_parse_fetch(struct ImapAccountData *adata, char *s)
   }
 
   if (flags)
-  {
-    imap_set_flags(adata->mailbox, e, flags, &server_changes);
-    if (server_changes)
-    {
-      /* If server flags could conflict with NeoMutt's flags, reopen the mailbox. */
-      if (e->changed)
-        mdata->reopen |= IMAP_EXPUNGE_PENDING;
-      else
-        mdata->check_status |= IMAP_FLAGS_PENDING;
-    }
-  }
+    fetch_set_flags(adata, e, flags);
 }
 
 /**
@@ -850,8 +1002,10 @@ static void cmd_parse_status(struct ImapAccountData *adata, char *s)
     mutt_debug(LL_DEBUG3, "Received status for an unexpected mailbox: %s\n", mailbox);
     return;
   }
+
   uint32_t olduv = mdata->uidvalidity;
   unsigned int oldun = mdata->uid_next;
+  bool got_unseen = false;
 
   if (*s++ != '(')
   {
@@ -898,7 +1052,10 @@ static void cmd_parse_status(struct ImapAccountData *adata, char *s)
         else if (mutt_str_startswith(s, "UIDNEXT"))
           mdata->uid_next = count;
         else if (mutt_str_startswith(s, "UNSEEN"))
+        {
           mdata->unseen = count;
+          got_unseen = true;
+        }
       }
     }
 
@@ -910,6 +1067,17 @@ static void cmd_parse_status(struct ImapAccountData *adata, char *s)
              mdata->name, mdata->uidvalidity, mdata->uid_next, mdata->messages,
              mdata->recent, mdata->unseen);
 
+  /* A NOTIFY event doesn't include the unseen count, so it only tells us
+   * that the mailbox has changed.  The next check will ask for its STATUS. */
+  if (adata->notify && !got_unseen)
+  {
+    mdata->uid_next = oldun;
+    mdata->notified = true;
+    mdata->status_stale = true;
+    return;
+  }
+  mdata->status_stale = false;
+
   mutt_debug(LL_DEBUG3, "Running default STATUS handler\n");
 
   mutt_debug(LL_DEBUG3, "Found %s in mailbox list (OV: %u ON: %u U: %d)\n",
@@ -1068,6 +1236,10 @@ static int cmd_handle_untagged(struct ImapAccountData *adata)
   {
     cmd_parse_search(adata, s);
   }
+  else if (mutt_istr_startswith(s, "ESEARCH"))
+  {
+    cmd_parse_esearch(adata, s);
+  }
   else if (mutt_istr_startswith(s, "STATUS"))
   {
     cmd_parse_status(adata, s);
@@ -1149,8 +1321,10 @@ int imap_cmd_step(struct ImapAccountData *adata)
   {
     if (len == adata->blen)
     {
-      mutt_mem_realloc(&adata->buf, adata->blen + IMAP_CMD_BUFSIZE);
-      adata->blen = adata->blen + IMAP_CMD_BUFSIZE;
+      /* grow geometrically, so a long line doesn't take many reads */
+      const size_t blen = MAX(adata->blen * 2, IMAP_CMD_BUFSIZE);
+      mutt_mem_realloc(&adata->buf, blen);
+      adata->blen = blen;
       mutt_debug(LL_DEBUG3, "grew buffer to %zu bytes\n", adata->blen);
     }
 
@@ -1181,6 +1355,7 @@ int imap_cmd_step(struct ImapAccountData *adata)
   }
 
   adata->lastread = mutt_date_now();
+  cmd_sample_rtt(adata);
 
   /* handle untagged messages. The caller still gets its shot afterwards. */
   if ((mutt_str_startswith(adata->buf, "* ") ||
@@ -1220,8 +1395,10 @@ int imap_cmd_step(struct ImapAccountData *adata)
         }
         cmd->state = cmd_status(adata->buf);
         rc = cmd->state;
+        cmd_adapt_window(adata, cmd);
         if (cmd->state == IMAP_RES_NO || cmd->state == IMAP_RES_BAD)
         {
+          adata->cmd_failures++;
           mutt_message(_("IMAP command failed: %s"), adata->buf);
         }
       }
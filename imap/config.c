@@ -76,6 +76,9 @@ static struct ConfigDef ImapVars[] = {
   { "imap_condstore", DT_BOOL, false, 0, NULL,
     "(imap) Enable the CONDSTORE extension"
   },
+  { "imap_connection_pool", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 0, 0, NULL,
+    "(imap) Number of extra connections for background work"
+  },
   { "imap_authenticators", DT_SLIST|D_SLIST_SEP_COLON, 0, 0, imap_auth_validator,
     "(imap) List of allowed IMAP authentication methods (colon-separated)"
   },
@@ -94,6 +97,9 @@ static struct ConfigDef ImapVars[] = {
   { "imap_login", DT_STRING|D_SENSITIVE, 0, 0, NULL,
     "(imap) Login name for the IMAP server (defaults to `$imap_user`)"
   },
+  { "imap_notify", DT_BOOL, false, 0, NULL,
+    "(imap) Use the IMAP NOTIFY extension to track changes to other mailboxes"
+  },
   { "imap_oauth_refresh_command", DT_STRING|D_STRING_COMMAND|D_SENSITIVE, 0, 0, NULL,
     "(imap) External command to generate OAUTH refresh token"
   },
@@ -124,6 +130,9 @@ static struct ConfigDef ImapVars[] = {
   { "imap_poll_timeout", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 15, 0, NULL,
     "(imap) Maximum time to wait for a server response"
   },
+  { "imap_prefetch", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 0, 0, NULL,
+    "(imap) Number of following messages to download in the background"
+  },
   { "imap_qresync", DT_BOOL, false, 0, NULL,
     "(imap) Enable the QRESYNC extension"
   },
@@ -41,9 +41,11 @@ struct ImapEmailData
   bool replied : 1; ///< Email has been replied to
 
   bool parsed : 1;
+  bool prefetch : 1; ///< Body has been requested by msg_prefetch()
 
   unsigned int uid; ///< 32-bit Message UID
   unsigned int msn; ///< Message Sequence Number
+  long size;        ///< Size of the message, from RFC822.SIZE, or 0 if unknown
 
   char *flags_system;
   char *flags_remote;
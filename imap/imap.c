@@ -287,53 +287,174 @@ static int select_email_uids(struct Email **emails, int num_emails, enum Message
 }
 
 /**
- * sync_helper - Sync flag changes to the server
+ * struct SyncFlag - A flag that is synced to the server
+ */
+struct SyncFlag
+{
+  enum MessageType flag; ///< NeoMutt flag, e.g. #MUTT_DELETED
+  AclFlags right;        ///< ACL needed to change the flag, see #AclFlags
+  const char *name;      ///< Name of server flag
+};
+
+/// Flags synced by sync_flags()
+static const struct SyncFlag SyncFlags[] = {
+  // clang-format off
+  { MUTT_DELETED, MUTT_ACL_DELETE, "\\Deleted"  },
+  { MUTT_FLAG,    MUTT_ACL_WRITE,  "\\Flagged"  },
+  { MUTT_OLD,     MUTT_ACL_WRITE,  "Old"       },
+  { MUTT_READ,    MUTT_ACL_SEEN,   "\\Seen"     },
+  { MUTT_REPLIED, MUTT_ACL_WRITE,  "\\Answered" },
+  // clang-format on
+};
+
+/// Number of different combinations of #SyncFlags
+#define SYNC_FLAG_SETS (1 << mutt_array_size(SyncFlags))
+
+/**
+ * flag_delta - Compare an Email's flag with the server's copy
+ * @param e    Email
+ * @param flag Flag type, e.g. #MUTT_REPLIED
+ * @retval  1 Flag must be set on the server
+ * @retval -1 Flag must be cleared on the server
+ * @retval  0 Flag is unchanged
+ */
+static int flag_delta(struct Email *e, enum MessageType flag)
+{
+  struct ImapEmailData *edata = imap_edata_get(e);
+  bool local = false;
+  bool remote = false;
+
+  switch (flag)
+  {
+    case MUTT_DELETED:
+      local = e->deleted;
+      remote = edata->deleted;
+      break;
+    case MUTT_FLAG:
+      local = e->flagged;
+      remote = edata->flagged;
+      break;
+    case MUTT_OLD:
+      local = e->old;
+      remote = edata->old;
+      break;
+    case MUTT_READ:
+      local = e->read;
+      remote = edata->read;
+      break;
+    case MUTT_REPLIED:
+      local = e->replied;
+      remote = edata->replied;
+      break;
+    default:
+      break;
+  }
+
+  if (local == remote)
+    return 0;
+  return local ? 1 : -1;
+}
+
+/**
+ * sync_flags - Sync flag changes to the server
  * @param m          Selected Imap Mailbox
- * @param emails     Array of Emails
+ * @param emails     Array of Emails, sorted by UID
  * @param num_emails Number of Emails in the array
- * @param right      ACL, see #AclFlags
- * @param flag       NeoMutt flag, e.g. #MUTT_DELETED
- * @param name       Name of server flag
  * @retval >=0 Success, number of messages
  * @retval  -1 Failure
+ *
+ * Emails are grouped by the set of flags that must be added, and by the set
+ * that must be removed.  Each group becomes one `UID STORE` command, e.g.
+ * `UID STORE 1:40,45 +FLAGS.SILENT (\Flagged \Seen)`
+ *
+ * @note The commands are queued and must be flushed with imap_exec()
  */
-static int sync_helper(struct Mailbox *m, struct Email **emails, int num_emails,
-                       AclFlags right, enum MessageType flag, const char *name)
+static int sync_flags(struct Mailbox *m, struct Email **emails, int num_emails)
 {
   struct ImapAccountData *adata = imap_adata_get(m);
   if (!adata)
     return -1;
 
-  if ((m->rights & right) == 0)
-    return 0;
+  unsigned int usable = 0;
+  for (size_t i = 0; i < mutt_array_size(SyncFlags); i++)
+  {
+    const struct SyncFlag *sf = &SyncFlags[i];
+    if ((m->rights & sf->right) == 0)
+      continue;
+    if ((sf->right == MUTT_ACL_WRITE) && !imap_has_flag(&imap_mdata_get(m)->flags, sf->name))
+      continue;
+    usable |= (1 << i);
+  }
 
-  if ((right == MUTT_ACL_WRITE) && !imap_has_flag(&imap_mdata_get(m)->flags, name))
+  if (usable == 0)
     return 0;
 
+  // UIDs grouped by the flags to be set [0], or cleared [1]
+  struct UidArray groups[2][SYNC_FLAG_SETS];
+  memset(groups, 0, sizeof(groups));
+
+  for (int i = 0; i < num_emails; i++)
+  {
+    struct Email *e = emails[i];
+
+    /* don't include pending expunged messages */
+    if (!e || !e->changed || !e->active || (e->index == INT_MAX))
+      continue;
+
+    unsigned int set = 0;
+    unsigned int clear = 0;
+    for (size_t j = 0; j < mutt_array_size(SyncFlags); j++)
+    {
+      if ((usable & (1 << j)) == 0)
+        continue;
+
+      const int delta = flag_delta(e, SyncFlags[j].flag);
+      if (delta > 0)
+        set |= (1 << j);
+      else if (delta < 0)
+        clear |= (1 << j);
+    }
+
+    if (set != 0)
+      ARRAY_ADD(&groups[0][set], imap_edata_get(e)->uid);
+    if (clear != 0)
+      ARRAY_ADD(&groups[1][clear], imap_edata_get(e)->uid);
+  }
+
   int count = 0;
-  char buf[1024] = { 0 };
+  int rc = 0;
+  struct Buffer *post = buf_pool_get();
 
-  struct UidArray uida = ARRAY_HEAD_INITIALIZER;
+  for (int sign = 0; (sign < 2) && (rc >= 0); sign++)
+  {
+    for (unsigned int set = 1; (set < SYNC_FLAG_SETS) && (rc >= 0); set++)
+    {
+      struct UidArray *uida = &groups[sign][set];
+      if (ARRAY_EMPTY(uida))
+        continue;
 
-  // Set the flag (+FLAGS) on matching emails
-  select_email_uids(emails, num_emails, flag, true, false, &uida);
-  snprintf(buf, sizeof(buf), "+FLAGS.SILENT (%s)", name);
-  int rc = imap_exec_msg_set(adata, "UID STORE", buf, &uida);
-  if (rc < 0)
-    return rc;
-  count += rc;
-  ARRAY_FREE(&uida);
+      buf_printf(post, "%cFLAGS.SILENT (", (sign == 0) ? '+' : '-');
+      for (size_t j = 0; j < mutt_array_size(SyncFlags); j++)
+      {
+        if (set & (1 << j))
+          buf_add_printf(post, "%s ", SyncFlags[j].name);
+      }
+      mutt_str_remove_trailing_ws(post->data);
+      buf_fix_dptr(post);
+      buf_addch(post, ')');
 
-  // Clear the flag (-FLAGS) on non-matching emails
-  select_email_uids(emails, num_emails, flag, true, true, &uida);
-  buf[0] = '-';
-  rc = imap_exec_msg_set(adata, "UID STORE", buf, &uida);
-  if (rc < 0)
-    return rc;
-  count += rc;
-  ARRAY_FREE(&uida);
+      rc = imap_exec_msg_set(adata, "UID STORE", buf_string(post), uida);
+      if (rc >= 0)
+        count += rc;
+    }
+  }
+
+  for (int sign = 0; sign < 2; sign++)
+    for (unsigned int set = 0; set < SYNC_FLAG_SETS; set++)
+      ARRAY_FREE(&groups[sign][set]);
 
-  return count;
+  buf_pool_release(&post);
+  return (rc < 0) ? rc : count;
 }
 
 /**
@@ -568,6 +689,11 @@ void imap_logout_all(void)
       continue;
 
     mutt_message(_("Closing connection to %s..."), conn->account.host);
+    struct ImapAccountData **ap = NULL;
+    ARRAY_FOREACH(ap, &adata->pool)
+    {
+      imap_logout(*ap);
+    }
     imap_logout(np->adata);
     mutt_clear_error();
   }
@@ -590,7 +716,7 @@ void imap_logout_all(void)
 int imap_read_literal(FILE *fp, struct ImapAccountData *adata,
                       unsigned long bytes, struct Progress *progress)
 {
-  char c;
+  char chunk[8192];
   bool r = false;
   struct Buffer buf = { 0 }; // Do not allocate, maybe it won't be used
 
@@ -600,9 +726,10 @@ int imap_read_literal(FILE *fp, struct ImapAccountData *adata,
 
   mutt_debug(LL_DEBUG2, "reading %lu bytes\n", bytes);
 
-  for (unsigned long pos = 0; pos < bytes; pos++)
+  for (unsigned long pos = 0; pos < bytes;)
   {
-    if (mutt_socket_readchar(adata->conn, &c) != 1)
+    const size_t len = MIN(sizeof(chunk), bytes - pos);
+    if (mutt_socket_readn(adata->conn, chunk, len) < 0)
     {
       mutt_debug(LL_DEBUG1, "error during read, %lu bytes read\n", pos);
       adata->status = IMAP_FATAL;
@@ -610,26 +737,36 @@ int imap_read_literal(FILE *fp, struct ImapAccountData *adata,
       buf_dealloc(&buf);
       return -1;
     }
+    pos += len;
 
-    if (r && (c != '\n'))
+    /* Convert CRLF to LF, copying the text between the CRs in one go.
+     * A CR at the end of a chunk is held until we see the next character. */
+    if (r && (chunk[0] != '\n'))
       fputc('\r', fp);
+    r = false;
 
-    if (c == '\r')
-    {
-      r = true;
-      continue;
-    }
-    else
+    const char *text = chunk;
+    const char *end = chunk + len;
+    while (text < end)
     {
-      r = false;
-    }
+      const char *cr = memchr(text, '\r', end - text);
+      const char *stop = cr ? cr : end;
+
+      fwrite(text, 1, stop - text, fp);
+      if (c_debug_level >= IMAP_LOG_LTRL)
+        buf_addstr_n(&buf, text, stop - text);
+
+      if (!cr)
+        break;
 
-    fputc(c, fp);
+      text = cr + 1;
+      if (text == end)
+        r = true;
+      else if (*text != '\n')
+        fputc('\r', fp);
+    }
 
-    if ((pos % 1024) == 0)
-      progress_update(progress, pos, -1);
-    if (c_debug_level >= IMAP_LOG_LTRL)
-      buf_addch(&buf, c);
+    progress_update(progress, pos, -1);
   }
 
   if (c_debug_level >= IMAP_LOG_LTRL)
@@ -722,6 +859,10 @@ void imap_expunge_mailbox(struct Mailbox *m, bool resort)
   }
 
 #ifdef USE_HCACHE
+  /* Keep the stored UIDs in step with the server, for the next CONDSTORE or
+   * QRESYNC reopen */
+  if (mdata->modseq)
+    imap_hcache_store_uid_seqset(mdata);
   imap_hcache_close(mdata);
 #endif
 
@@ -858,6 +999,7 @@ void imap_close_connection(struct ImapAccountData *adata)
   adata->lastcmd = 0;
   adata->status = 0;
   memset(adata->cmds, 0, sizeof(struct ImapCommand) * adata->cmdslots);
+  imap_cmd_window_reset(adata);
 }
 
 /**
@@ -1078,6 +1220,8 @@ enum MxStatus imap_check_mailbox(struct Mailbox *m, bool force)
    * changes to process, since we can reopen here. */
   imap_cmd_finish(adata);
 
+  imap_adata_pool_drain(adata);
+
   enum MxStatus check = MX_STATUS_OK;
   if (mdata->check_status & IMAP_EXPUNGE_PENDING)
     check = MX_STATUS_REOPENED;
@@ -1095,6 +1239,22 @@ enum MxStatus imap_check_mailbox(struct Mailbox *m, bool force)
   return check;
 }
 
+/**
+ * notify_read - Process the NOTIFY events waiting on a connection
+ * @param adata IMAP Account data
+ *
+ * The events are untagged STATUS responses, see cmd_parse_status().
+ */
+static void notify_read(struct ImapAccountData *adata)
+{
+  while ((adata->state >= IMAP_AUTHENTICATED) && buf_is_empty(&adata->cmdbuf) &&
+         (mutt_socket_poll(adata->conn, 0) > 0))
+  {
+    if (imap_cmd_step(adata) < 0)
+      break;
+  }
+}
+
 /**
  * imap_status - Refresh the number of total and new messages
  * @param adata  IMAP Account data
@@ -1123,6 +1283,14 @@ static int imap_status(struct ImapAccountData *adata, struct ImapMboxData *mdata
   if (adata->mailbox && !adata->mailbox->poll_new_mail)
     return mdata->messages;
 
+  /* With NOTIFY, only ask about mailboxes that the server says have changed */
+  if (adata->notify)
+  {
+    notify_read(adata);
+    if (mdata->notified && !mdata->status_stale)
+      return mdata->messages;
+  }
+
   if (adata->capabilities & IMAP_CAP_IMAP4REV1)
   {
     uidvalidity_flag = "UIDVALIDITY";
@@ -1140,6 +1308,17 @@ static int imap_status(struct ImapAccountData *adata, struct ImapMboxData *mdata
   snprintf(cmd, sizeof(cmd), "STATUS %s (UIDNEXT %s UNSEEN RECENT MESSAGES)",
            mdata->munge_name, uidvalidity_flag);
 
+  /* Prefer a background connection.  A queued STATUS is sent straight away
+   * and its answer is processed the next time the connection is used. */
+  struct ImapAccountData *pool = imap_adata_pool_get(adata);
+  if (pool)
+  {
+    if (queue && (imap_cmd_start(pool, cmd) == 0))
+      return mdata->messages;
+    if (!queue && (imap_exec(pool, cmd, IMAP_CMD_POLL) == IMAP_EXEC_SUCCESS))
+      return mdata->messages;
+  }
+
   int rc = imap_exec(adata, cmd, queue ? IMAP_CMD_QUEUE : IMAP_CMD_POLL);
   if (rc != IMAP_EXEC_SUCCESS)
   {
@@ -1550,7 +1729,11 @@ enum MxStatus imap_sync_mailbox(struct Mailbox *m, bool expunge, bool close)
     if (e->active && e->changed)
     {
 #ifdef USE_HCACHE
-      imap_hcache_put(mdata, e);
+      /* Only the flags have changed, unless the envelope has */
+      if (e->env->changed)
+        imap_hcache_put(mdata, e);
+      else
+        imap_hcache_put_flags(mdata, e);
 #endif
       /* if the message has been rethreaded or attachments have been deleted
        * we delete the message and reupload it.
@@ -1577,27 +1760,23 @@ enum MxStatus imap_sync_mailbox(struct Mailbox *m, bool expunge, bool close)
   imap_hcache_close(mdata);
 #endif
 
-  /* presort here to avoid doing 10 resorts in imap_exec_msg_set */
+  /* presort here so that the UIDs in sync_flags() are in order */
   emails = mutt_mem_malloc(m->msg_count * sizeof(struct Email *));
   memcpy(emails, m->emails, m->msg_count * sizeof(struct Email *));
   mutt_qsort_r(emails, m->msg_count, sizeof(struct Email *), imap_sort_email_uid, NULL);
 
-  rc = sync_helper(m, emails, m->msg_count, MUTT_ACL_DELETE, MUTT_DELETED, "\\Deleted");
-  if (rc >= 0)
-    rc |= sync_helper(m, emails, m->msg_count, MUTT_ACL_WRITE, MUTT_FLAG, "\\Flagged");
-  if (rc >= 0)
-    rc |= sync_helper(m, emails, m->msg_count, MUTT_ACL_WRITE, MUTT_OLD, "Old");
-  if (rc >= 0)
-    rc |= sync_helper(m, emails, m->msg_count, MUTT_ACL_SEEN, MUTT_READ, "\\Seen");
-  if (rc >= 0)
-    rc |= sync_helper(m, emails, m->msg_count, MUTT_ACL_WRITE, MUTT_REPLIED, "\\Answered");
+  /* The STOREs are pipelined, so only the last result is returned */
+  const unsigned int failures = adata->cmd_failures;
+  rc = sync_flags(m, emails, m->msg_count);
 
   FREE(&emails);
 
-  /* Flush the queued flags if any were changed in sync_helper. */
+  /* Flush the queued flags if any were changed in sync_flags(). */
   if (rc > 0)
     if (imap_exec(adata, NULL, IMAP_CMD_NO_FLAGS) != IMAP_EXEC_SUCCESS)
       rc = -1;
+  if (adata->cmd_failures != failures)
+    rc = -1;
 
   if (rc < 0)
   {
@@ -1848,6 +2027,22 @@ int imap_login(struct ImapAccountData *adata)
     /* we may need the root delimiter before we open a mailbox */
     imap_exec(adata, NULL, IMAP_CMD_NO_FLAGS);
 
+    /* RFC5465: have the server report changes to the other mailboxes.
+     * The STATUS indicator gets an initial report for each of them.  The
+     * selected mailbox takes precedence, so it keeps getting EXISTS, EXPUNGE
+     * and FETCH, rather than STATUS. */
+    adata->notify = false;
+    const bool c_imap_notify = cs_subset_bool(NeoMutt->sub, "imap_notify");
+    if (c_imap_notify && (adata->capabilities & IMAP_CAP_NOTIFY) &&
+        adata->account && (adata->account->adata == adata))
+    {
+      adata->notify = (imap_exec(adata,
+                                 "NOTIFY SET STATUS "
+                                 "(SELECTED (MessageNew (uid flags) MessageExpunge FlagChange)) "
+                                 "(PERSONAL (MessageNew MessageExpunge))",
+                                 IMAP_CMD_NO_FLAGS) == IMAP_EXEC_SUCCESS);
+    }
+
     /* select the mailbox that used to be open before disconnect */
     if (adata->mailbox)
     {
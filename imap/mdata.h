@@ -54,6 +54,8 @@ struct ImapMboxData
   unsigned int messages;
   unsigned int recent;
   unsigned int unseen;
+  bool notified;     ///< NOTIFY reports changes to this mailbox
+  bool status_stale; ///< NOTIFY reported a change, STATUS is needed
 
   // Cached data used only when the mailbox is opened
   struct HashTable *uid_hash;               ///< Hash Table: "uid" -> Email
@@ -98,6 +98,64 @@ static struct BodyCache *imap_bcache_open(struct Mailbox *m)
   return bc;
 }
 
+/**
+ * msg_cache_key - Identify the contents of an email for the shared cache
+ * @param[in]  m      Selected Imap Mailbox
+ * @param[in]  e      Email
+ * @param[out] buf    Buffer for the key
+ * @param[in]  buflen Length of buffer, at least 33 bytes
+ * @retval true A key was created
+ *
+ * The key is made from the account, the Message-ID and the server's
+ * RFC822.SIZE, so it's known before the message is downloaded.  Messages are
+ * only shared between the mailboxes of one account.
+ */
+static bool msg_cache_key(struct Mailbox *m, struct Email *e, char *buf, size_t buflen)
+{
+  const bool c_message_cache_shared = cs_subset_bool(NeoMutt->sub, "message_cache_shared");
+  struct ImapAccountData *adata = imap_adata_get(m);
+  struct ImapEmailData *edata = imap_edata_get(e);
+  if (!c_message_cache_shared || !adata || !e->env || !e->env->message_id ||
+      !edata || (edata->size <= 0) || (buflen < 33))
+  {
+    return false;
+  }
+
+  struct ConnAccount *cac = &adata->conn->account;
+  char tmp[1024] = { 0 };
+  snprintf(tmp, sizeof(tmp), "%s@%s:%u %s %ld", cac->user, cac->host,
+           cac->port, e->env->message_id, edata->size);
+
+  unsigned char digest[16] = { 0 };
+  mutt_md5(tmp, digest);
+  mutt_md5_toascii(digest, buf);
+  return true;
+}
+
+/**
+ * msg_cache_matches - Does a cached message belong to an email?
+ * @param fp File of the cached message
+ * @param e  Email
+ * @retval true The message has the Email's Message-ID, From, Date and Subject
+ *
+ * A shared message is found by its Message-ID and size, which the sender
+ * controls, so check that it's really the same message.
+ */
+static bool msg_cache_matches(FILE *fp, struct Email *e)
+{
+  struct Email *e_cache = email_new();
+  e_cache->env = mutt_rfc822_read_header(fp, e_cache, false, false);
+  rewind(fp);
+
+  const bool match = mutt_str_equal(e_cache->env->message_id, e->env->message_id) &&
+                     mutt_str_equal(e_cache->env->subject, e->env->subject) &&
+                     mutt_addrlist_equal(&e_cache->env->from, &e->env->from) &&
+                     (e_cache->date_sent == e->date_sent);
+
+  email_free(&e_cache);
+  return match;
+}
+
 /**
  * msg_cache_get - Get the message cache entry for an email
  * @param m     Selected Imap Mailbox
@@ -116,7 +174,23 @@ static FILE *msg_cache_get(struct Mailbox *m, struct Email *e)
   mdata->bcache = imap_bcache_open(m);
   char id[64] = { 0 };
   snprintf(id, sizeof(id), "%u-%u", mdata->uidvalidity, imap_edata_get(e)->uid);
-  return mutt_bcache_get(mdata->bcache, id);
+  FILE *fp = mutt_bcache_get(mdata->bcache, id);
+
+  /* Another mailbox may have a copy */
+  char key[33] = { 0 };
+  if (!fp && msg_cache_key(m, e, key, sizeof(key)) &&
+      (mutt_bcache_reuse(mdata->bcache, id, key) == 0))
+  {
+    fp = mutt_bcache_get(mdata->bcache, id);
+    if (fp && !msg_cache_matches(fp, e))
+    {
+      mutt_debug(LL_DEBUG1, "shared copy of %s doesn't match\n", e->env->message_id);
+      mutt_file_fclose(&fp);
+      mutt_bcache_del(mdata->bcache, id);
+    }
+  }
+
+  return fp;
 }
 
 /**
@@ -159,7 +233,38 @@ static int msg_cache_commit(struct Mailbox *m, struct Email *e)
   char id[64] = { 0 };
   snprintf(id, sizeof(id), "%u-%u", mdata->uidvalidity, imap_edata_get(e)->uid);
 
-  return mutt_bcache_commit(mdata->bcache, id);
+  int rc = mutt_bcache_commit(mdata->bcache, id);
+
+  char key[33] = { 0 };
+  if ((rc == 0) && msg_cache_key(m, e, key, sizeof(key)))
+    mutt_bcache_share(mdata->bcache, id, key);
+
+  return rc;
+}
+
+/**
+ * msg_cache_exists - Is an email in the message cache?
+ * @param m     Selected Imap Mailbox
+ * @param e     Email
+ * @retval true The email is cached
+ */
+static bool msg_cache_exists(struct Mailbox *m, struct Email *e)
+{
+  struct ImapAccountData *adata = imap_adata_get(m);
+  struct ImapMboxData *mdata = imap_mdata_get(m);
+
+  if (!e || !adata || (adata->mailbox != m))
+    return false;
+
+  mdata->bcache = imap_bcache_open(m);
+  char id[64] = { 0 };
+  snprintf(id, sizeof(id), "%u-%u", mdata->uidvalidity, imap_edata_get(e)->uid);
+  if (mutt_bcache_exists(mdata->bcache, id) == 0)
+    return true;
+
+  /* msg_cache_get() will link to a shared copy */
+  char key[33] = { 0 };
+  return msg_cache_key(m, e, key, sizeof(key)) && (mutt_bcache_shared_exists(key) == 0);
 }
 
 /**
@@ -363,6 +468,7 @@ static int msg_parse_fetch(struct ImapHeader *h, char *s)
       *ptmp = '\0';
       if (!mutt_str_atol(tmp, &h->content_length))
         return -1;
+      h->edata->size = h->content_length;
     }
     else if (mutt_istr_startswith(s, "BODY") || mutt_istr_startswith(s, "RFC822.HEADER"))
     {
@@ -702,8 +808,10 @@ static int read_headers_normal_eval_cache(struct ImapAccountData *adata,
   /* If we are using CONDSTORE's "FETCH CHANGEDSINCE", then we keep
    * the flags in the header cache, and update them further below.
    * Otherwise, we fetch the current state of the flags here. */
-  snprintf(buf, sizeof(buf), "UID FETCH 1:%u (UID%s)", uid_next - 1,
-           eval_condstore ? "" : " FLAGS");
+  /* The shared message cache needs the sizes */
+  const bool c_message_cache_shared = cs_subset_bool(NeoMutt->sub, "message_cache_shared");
+  snprintf(buf, sizeof(buf), "UID FETCH 1:%u (UID%s%s)", uid_next - 1,
+           eval_condstore ? "" : " FLAGS", c_message_cache_shared ? " RFC822.SIZE" : "");
 
   imap_cmd_start(adata, buf);
 
@@ -794,7 +902,7 @@ static int read_headers_normal_eval_cache(struct ImapAccountData *adata,
         /* If this is the first time we are fetching, we need to
          * store the current state of flags back into the header cache */
         if (!eval_condstore && store_flag_updates)
-          imap_hcache_put(mdata, e);
+          imap_hcache_put_flags(mdata, e);
 
         h.edata = NULL;
         idx++;
@@ -821,6 +929,7 @@ fail:
  * @retval  -1 Error
  *
  * For QRESYNC, we grab the UIDs in order by MSN from the header cache.
+ * CONDSTORE does the same, if no messages have been added or removed.
  *
  * In read_headers_condstore_qresync_updates().  We will update change flags
  * using CHANGEDSINCE and find out what UIDs have been expunged using VANISHED.
@@ -899,6 +1008,35 @@ static int read_headers_qresync_eval_cache(struct ImapAccountData *adata, char *
   return rc;
 }
 
+/**
+ * uid_seqset_count - Count the UIDs in a stored UID seqset
+ * @param uid_seqset UID seqset, e.g. "1:4,6"
+ * @retval num Number of UIDs
+ * @retval -1  The seqset contains a blank, or is invalid
+ */
+static int uid_seqset_count(const char *uid_seqset)
+{
+  struct SeqsetIterator *iter = mutt_seqset_iterator_new(uid_seqset);
+  if (!iter)
+    return -1;
+
+  int count = 0;
+  unsigned int uid = 0;
+  int rc;
+  while ((rc = mutt_seqset_iterator_next(iter, &uid)) == 0)
+  {
+    if (uid == 0)
+    {
+      count = -1;
+      break;
+    }
+    count++;
+  }
+
+  mutt_seqset_iterator_free(&iter);
+  return (rc < 0) ? -1 : count;
+}
+
 /**
  * read_headers_condstore_qresync_updates - Retrieve updates from the server
  * @param adata        Imap Account data
@@ -965,7 +1103,7 @@ static int read_headers_condstore_qresync_updates(struct ImapAccountData *adata,
       continue;
     }
 
-    imap_hcache_put(mdata, imap_msn_get(&mdata->msn, header_msn - 1));
+    imap_hcache_put_flags(mdata, imap_msn_get(&mdata->msn, header_msn - 1));
   }
 
   if (rc != IMAP_RES_OK)
@@ -1175,15 +1313,37 @@ static int read_headers_fetch_new(struct Mailbox *m, unsigned int msn_begin,
    *   at the end of the loop makes the comparison unneeded, but to be
    *   cautious I'm keeping it.
    */
+  /* A failed FETCH, other than the last, is hidden by the ones after it */
+  const unsigned int failures = adata->cmd_failures;
+
   edata = imap_edata_new();
-  while ((fetch_msn_end < msn_end) &&
-         imap_fetch_msn_seqset(buf, adata, evalhc, msn_begin, msn_end, &fetch_msn_end))
+  while (fetch_msn_end < msn_end)
   {
-    char *cmd = NULL;
-    mutt_str_asprintf(&cmd, "FETCH %s (UID FLAGS INTERNALDATE RFC822.SIZE %s)",
-                      buf_string(buf), hdrreq);
-    imap_cmd_start(adata, cmd);
-    FREE(&cmd);
+    /* Pipeline the chunks, so we don't wait a round trip between them.
+     * The command queue mustn't fill up, because draining it would pass the
+     * FETCH responses to the generic handlers. */
+    const int max_chunks = MAX(imap_cmd_queue_space(adata), 1);
+    int chunks = 0;
+    unsigned int chunk_begin = msn_begin;
+    while ((chunks < max_chunks) && (fetch_msn_end < msn_end) &&
+           imap_fetch_msn_seqset(buf, adata, evalhc, chunk_begin, msn_end, &fetch_msn_end))
+    {
+      char *cmd = NULL;
+      mutt_str_asprintf(&cmd, "FETCH %s (UID FLAGS INTERNALDATE RFC822.SIZE %s)",
+                        buf_string(buf), hdrreq);
+      const int rc_queue = imap_exec(adata, cmd, IMAP_CMD_QUEUE);
+      FREE(&cmd);
+      if (rc_queue != IMAP_EXEC_SUCCESS)
+        goto bail;
+
+      chunk_begin = fetch_msn_end + 1;
+      chunks++;
+    }
+
+    if (chunks == 0)
+      break;
+    if (imap_cmd_start(adata, NULL) < 0)
+      goto bail;
 
     int msgno = msn_begin;
 
@@ -1201,7 +1361,7 @@ static int read_headers_fetch_new(struct Mailbox *m, unsigned int msn_begin,
       const int rc2 = imap_cmd_step(adata);
       if (rc2 != IMAP_RES_CONTINUE)
       {
-        if (rc2 != IMAP_RES_OK)
+        if ((rc2 != IMAP_RES_OK) || (adata->cmd_failures != failures))
         {
           goto bail;
         }
@@ -1352,6 +1512,7 @@ int imap_read_headers(struct Mailbox *m, unsigned int msn_begin,
   bool has_qresync = false;
   bool eval_condstore = false;
   bool eval_qresync = false;
+  bool eval_snapshot = false;
   char *uid_seqset = NULL;
   const unsigned int msn_begin_save = msn_begin;
 #endif /* USE_HCACHE */
@@ -1405,13 +1566,28 @@ retry:
         }
 
         if (!eval_qresync && has_condstore)
+        {
           eval_condstore = true;
+
+          /* If no messages have been added or expunged, the stored UIDs are
+           * still valid, so we don't need to fetch them all. */
+          uid_seqset = imap_hcache_get_uid_seqset(mdata);
+          if (uid_seqset && (uid_next == mdata->uid_next) &&
+              (uid_seqset_count(uid_seqset) == msn_end))
+          {
+            eval_snapshot = true;
+          }
+          else
+          {
+            FREE(&uid_seqset);
+          }
+        }
       }
     }
   }
   if (evalhc)
   {
-    if (eval_qresync)
+    if (eval_qresync || eval_snapshot)
     {
       if (read_headers_qresync_eval_cache(adata, uid_seqset) < 0)
         goto bail;
@@ -1446,12 +1622,13 @@ retry:
     goto bail;
 
 #ifdef USE_HCACHE
-  if (eval_qresync && initial_download)
+  if ((eval_qresync || eval_snapshot) && initial_download)
   {
     if (imap_verify_qresync(m) != 0)
     {
       eval_qresync = false;
       eval_condstore = false;
+      eval_snapshot = false;
       evalhc = false;
       modseq = 0;
       maxuid = 0;
@@ -1479,6 +1656,13 @@ retry:
   if (mdata->uid_next > 1)
   {
     hcache_store_raw(mdata->hcache, "UIDNEXT", 7, &mdata->uid_next, sizeof(mdata->uid_next));
+
+    /* A CONDSTORE reopen trusts the UIDs if UIDNEXT hasn't changed,
+     * so they must be stored together */
+    if (has_condstore || has_qresync)
+      imap_hcache_store_uid_seqset(mdata);
+    else
+      imap_hcache_clear_uid_seqset(mdata);
   }
 
   /* We currently only sync CONDSTORE and QRESYNC on the initial download.
@@ -1495,11 +1679,6 @@ retry:
     {
       hcache_delete_raw(mdata->hcache, "MODSEQ", 6);
     }
-
-    if (has_qresync)
-      imap_hcache_store_uid_seqset(mdata);
-    else
-      imap_hcache_clear_uid_seqset(mdata);
   }
 #endif /* USE_HCACHE */
 
@@ -1895,6 +2074,7 @@ int imap_cache_clean(struct Mailbox *m)
 
   mdata->bcache = imap_bcache_open(m);
   mutt_bcache_list(mdata->bcache, imap_bcache_delete, mdata);
+  mutt_bcache_clean_shared();
 
   return 0;
 }
@@ -1939,6 +2119,7 @@ char *imap_set_flags(struct Mailbox *m, struct Email *e, char *s, bool *server_c
   /* We take a copy of the tags so we can split the string */
   char *tags_copy = mutt_str_dup(edata->flags_remote);
   driver_tags_replace(&e->tags, tags_copy);
+  e->changes++;
   FREE(&tags_copy);
 
   /* YAUH (yet another ugly hack): temporarily set context to
@@ -1971,6 +2152,100 @@ char *imap_set_flags(struct Mailbox *m, struct Email *e, char *s, bool *server_c
   return s;
 }
 
+/**
+ * msg_prefetch - Start downloading the emails that follow
+ * @param m Selected Imap Mailbox
+ * @param e Email that has just been opened
+ *
+ * Up to `$imap_prefetch` emails following @a e in the index are requested, but
+ * not waited for.  The bodies are saved by imap_cache_literal() as they
+ * arrive.
+ */
+static void msg_prefetch(struct Mailbox *m, struct Email *e)
+{
+  struct ImapAccountData *adata = imap_adata_get(m);
+
+  const short c_imap_prefetch = cs_subset_number(NeoMutt->sub, "imap_prefetch");
+  if ((c_imap_prefetch <= 0) || !m->v2r || (e->vnum < 0) ||
+      !(adata->capabilities & IMAP_CAP_IMAP4REV1))
+    return;
+
+  /* Without a message cache, prefetched bodies would be thrown away */
+  struct ImapMboxData *mdata = imap_mdata_get(m);
+  mdata->bcache = imap_bcache_open(m);
+  if (!mdata->bcache)
+    return;
+
+  /* Don't get in the way of other commands.  While idling, the only thing
+   * queued is the DONE, which will end the IDLE when the FETCH is sent. */
+  if ((adata->state == IMAP_IDLE) ?
+          !mutt_str_equal(buf_string(&adata->cmdbuf), "DONE\r\n") :
+          ((adata->nextcmd != adata->lastcmd) || !buf_is_empty(&adata->cmdbuf)))
+  {
+    return;
+  }
+
+  struct Buffer *cmd = buf_pool_get();
+  for (int vnum = e->vnum + 1; (vnum <= e->vnum + c_imap_prefetch) && (vnum < m->vcount); vnum++)
+  {
+    const int inum = m->v2r[vnum];
+    if ((inum < 0) || (inum >= m->msg_count))
+      break;
+
+    struct Email *e_next = m->emails[inum];
+    if (!e_next || e_next->deleted || msg_cache_exists(m, e_next))
+      continue;
+
+    struct ImapEmailData *edata = imap_edata_get(e_next);
+    edata->prefetch = true;
+    buf_add_printf(cmd, "%s%u", buf_is_empty(cmd) ? "UID FETCH " : ",", edata->uid);
+  }
+
+  if (!buf_is_empty(cmd))
+  {
+    buf_addstr(cmd, " BODY.PEEK[]");
+    mutt_debug(LL_DEBUG2, "prefetching: %s\n", buf_string(cmd));
+    imap_cmd_start(adata, buf_string(cmd));
+  }
+  buf_pool_release(&cmd);
+}
+
+/**
+ * imap_cache_literal - Save a message literal in the message cache
+ * @param m     Selected Imap Mailbox
+ * @param e     Email
+ * @param bytes Size of the literal
+ * @retval  0 Success
+ * @retval -1 Failure
+ *
+ * This handles the bodies requested by msg_prefetch().  If the message can't
+ * be cached, the literal is read and discarded.
+ */
+int imap_cache_literal(struct Mailbox *m, struct Email *e, unsigned long bytes)
+{
+  struct ImapAccountData *adata = imap_adata_get(m);
+  if (!adata)
+    return -1;
+
+  FILE *fp = msg_cache_put(m, e);
+  const bool cached = fp;
+  if (!fp)
+    fp = mutt_file_mkstemp();
+  if (!fp)
+    return -1;
+
+  imap_edata_get(e)->prefetch = false;
+
+  int rc = imap_read_literal(fp, adata, bytes, NULL);
+  if ((mutt_file_fclose(&fp) != 0) && (rc == 0))
+    rc = -1;
+
+  if (cached && (rc == 0) && (msg_cache_commit(m, e) < 0))
+    mutt_debug(LL_DEBUG1, "failed to add message to cache\n");
+
+  return rc;
+}
+
 /**
  * imap_msg_open - Open an email message in a Mailbox - Implements MxOps::msg_open() - @ingroup mx_msg_open
  */
@@ -1994,12 +2269,25 @@ bool imap_msg_open(struct Mailbox *m, struct Message *msg, struct Email *e)
   if (!adata || (adata->mailbox != m))
     return false;
 
+  /* An earlier prefetch may be downloading this email */
+  struct ImapEmailData *edata = imap_edata_get(e);
+  if (edata->prefetch && (adata->state != IMAP_IDLE) && buf_is_empty(&adata->cmdbuf))
+  {
+    while (edata->prefetch && (adata->nextcmd != adata->lastcmd) &&
+           (imap_cmd_step(adata) == IMAP_RES_CONTINUE))
+    {
+      ; // do nothing
+    }
+  }
+  edata->prefetch = false;
+
   msg->fp = msg_cache_get(m, e);
   if (msg->fp)
   {
-    if (imap_edata_get(e)->parsed)
-      return true;
-    goto parsemsg;
+    if (!imap_edata_get(e)->parsed)
+      goto parsemsg;
+    msg_prefetch(m, e);
+    return true;
   }
 
   /* This function is called in a few places after endwin()
@@ -2153,6 +2441,7 @@ parsemsg:
     goto parsemsg;
   }
 
+  msg_prefetch(m, e);
   return true;
 
 bail:
@@ -139,8 +139,10 @@ typedef uint32_t ImapCapFlags;              ///< Flags, e.g. #IMAP_CAP_IMAP4
 #define IMAP_CAP_COMPRESS         (1 << 18) ///< RFC4978: COMPRESS=DEFLATE
 #define IMAP_CAP_X_GM_EXT_1       (1 << 19) ///< https://developers.google.com/gmail/imap/imap-extensions
 #define IMAP_CAP_ID               (1 << 20) ///< RFC2971: IMAP4 ID extension
+#define IMAP_CAP_ESEARCH          (1 << 21) ///< RFC4731: IMAP4 Extension to SEARCH Command
+#define IMAP_CAP_NOTIFY           (1 << 22) ///< RFC5465: IMAP NOTIFY Extension
 
-#define IMAP_CAP_ALL             ((1 << 21) - 1)
+#define IMAP_CAP_ALL             ((1 << 23) - 1)
 
 /**
  * struct ImapList - Items in an IMAP browser
@@ -160,6 +162,8 @@ struct ImapCommand
 {
   char seq[SEQ_LEN + 1]; ///< Command tag, e.g. 'a0001'
   int state;            ///< Command state, e.g. #IMAP_RES_NEW
+  uint64_t sent;        ///< Time the command was sent, in milliseconds
+  bool timed;           ///< Command was sent alone, so its round trip is measured
 };
 
 /**
@@ -201,12 +205,15 @@ bool imap_code(const char *s);
 const char *imap_cmd_trailer(struct ImapAccountData *adata);
 int imap_exec(struct ImapAccountData *adata, const char *cmdstr, ImapCmdFlags flags);
 int imap_cmd_idle(struct ImapAccountData *adata);
+int imap_cmd_queue_space(struct ImapAccountData *adata);
+void imap_cmd_window_reset(struct ImapAccountData *adata);
 
 /* message.c */
 int imap_read_headers(struct Mailbox *m, unsigned int msn_begin, unsigned int msn_end, bool initial_download);
 char *imap_set_flags(struct Mailbox *m, struct Email *e, char *s, bool *server_changes);
 int imap_cache_del(struct Mailbox *m, struct Email *e);
 int imap_cache_clean(struct Mailbox *m);
+int imap_cache_literal(struct Mailbox *m, struct Email *e, unsigned long bytes);
 int imap_append_message(struct Mailbox *m, struct Message *msg);
 
 bool imap_msg_open(struct Mailbox *m, struct Message *msg, struct Email *e);
@@ -220,6 +227,7 @@ void imap_hcache_open(struct ImapAccountData *adata, struct ImapMboxData *mdata,
 void imap_hcache_close(struct ImapMboxData *mdata);
 struct Email *imap_hcache_get(struct ImapMboxData *mdata, unsigned int uid);
 int imap_hcache_put(struct ImapMboxData *mdata, struct Email *e);
+int imap_hcache_put_flags(struct ImapMboxData *mdata, struct Email *e);
 int imap_hcache_del(struct ImapMboxData *mdata, unsigned int uid);
 int imap_hcache_store_uid_seqset(struct ImapMboxData *mdata);
 int imap_hcache_clear_uid_seqset(struct ImapMboxData *mdata);
@@ -255,5 +263,6 @@ void imap_disallow_reopen(struct Mailbox *m);
 
 /* search.c */
 void cmd_parse_search(struct ImapAccountData *adata, const char *s);
+void cmd_parse_esearch(struct ImapAccountData *adata, const char *s);
 
 #endif /* MUTT_IMAP_PRIVATE_H */
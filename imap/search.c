@@ -30,6 +30,7 @@
 #include "config.h"
 #include <stdbool.h>
 #include <string.h>
+#include <time.h>
 #include "private.h"
 #include "mutt/lib.h"
 #include "email/lib.h"
@@ -44,7 +45,7 @@ static int check_pattern_list(const struct PatternList *patterns);
 
 // fwd-decl, mutually recursive: compile_search, compile_search_children
 static bool compile_search(const struct ImapAccountData *adata,
-                           const struct Pattern *pat, struct Buffer *buf);
+                           const struct Pattern *pat, bool exact, struct Buffer *buf);
 
 /**
  * check_pattern - Check whether a pattern can be searched server-side
@@ -91,33 +92,84 @@ static int check_pattern_list(const struct PatternList *patterns)
   return positives;
 }
 
+/**
+ * check_pattern_exact - Can the server evaluate a pattern exactly?
+ * @param m   Mailbox
+ * @param pat Pattern to check
+ * @retval true  The server's answer will match NeoMutt's
+ * @retval false Part of the pattern must be evaluated locally
+ *
+ * The server only knows the flags that have been synced, so they can only be
+ * trusted if there are no local changes.  String matches are case-insensitive
+ * on the server, so only lower-case (case-insensitive) strings are accepted.
+ * The server matches addresses against the whole header, not just the
+ * mailbox and personal name, so address patterns are never exact.
+ */
+static bool check_pattern_exact(const struct Mailbox *m, const struct Pattern *pat)
+{
+  switch (pat->op)
+  {
+    case MUTT_PAT_AND:
+    case MUTT_PAT_OR:
+    {
+      const struct Pattern *c = NULL;
+      SLIST_FOREACH(c, pat->child, entries)
+      {
+        if (!check_pattern_exact(m, c))
+          return false;
+      }
+      return true;
+    }
+    case MUTT_ALL:
+      return true;
+    case MUTT_FLAG:
+    case MUTT_DELETED:
+    case MUTT_REPLIED:
+    case MUTT_READ:
+    case MUTT_UNREAD:
+      return !m->changed;
+    case MUTT_PAT_SUBJECT:
+    case MUTT_PAT_ID:
+    case MUTT_PAT_XLABEL:
+      return pat->string_match && pat->ign_case && !pat->all_addr && !pat->is_alias;
+    default:
+      return check_pattern(pat);
+  }
+}
+
 /**
  * compile_search_children - Compile a search command for a pattern's children
  * @param adata Imap Account data
- * @param pat Parent pattern
- * @param buf Buffer for the resulting command
+ * @param pat   Parent pattern
+ * @param exact Compile the entire pattern, not just the full-text parts
+ * @param buf   Buffer for the resulting command
  * @retval true  Success
  * @retval false Failure
  */
 static bool compile_search_children(const struct ImapAccountData *adata,
-                                    const struct Pattern *pat, struct Buffer *buf)
+                                    const struct Pattern *pat, bool exact,
+                                    struct Buffer *buf)
 {
-  int clauses = check_pattern_list(pat->child);
+  int clauses = 0;
+  struct Pattern *c;
+  SLIST_FOREACH(c, pat->child, entries)
+  {
+    clauses += (exact || check_pattern(c));
+  }
   if (clauses == 0)
     return true;
 
   buf_addch(buf, '(');
 
-  struct Pattern *c;
   SLIST_FOREACH(c, pat->child, entries)
   {
-    if (!check_pattern(c))
+    if (!exact && !check_pattern(c))
       continue;
 
     if ((pat->op == MUTT_PAT_OR) && (clauses > 1))
       buf_addstr(buf, "OR ");
 
-    if (!compile_search(adata, c, buf))
+    if (!compile_search(adata, c, exact, buf))
       return false;
 
     if (clauses > 1)
@@ -130,6 +182,20 @@ static bool compile_search_children(const struct ImapAccountData *adata,
   return true;
 }
 
+/**
+ * compile_search_string - Add a search key and a quoted string
+ * @param buf Buffer for the resulting command
+ * @param key IMAP search key, e.g. "SUBJECT"
+ * @param str String to search for
+ */
+static void compile_search_string(struct Buffer *buf, const char *key, const char *str)
+{
+  char term[256] = { 0 };
+
+  imap_quote_string(term, sizeof(term), str, false);
+  buf_add_printf(buf, "%s %s", key, term);
+}
+
 /**
  * compile_search_self - Compile a search command for a pattern
  * @param adata Imap Account data
@@ -169,14 +235,10 @@ static bool compile_search_self(const struct ImapAccountData *adata,
       buf_addstr(buf, term);
       break;
     case MUTT_PAT_BODY:
-      buf_addstr(buf, "BODY ");
-      imap_quote_string(term, sizeof(term), pat->p.str, false);
-      buf_addstr(buf, term);
+      compile_search_string(buf, "BODY", pat->p.str);
       break;
     case MUTT_PAT_WHOLE_MSG:
-      buf_addstr(buf, "TEXT ");
-      imap_quote_string(term, sizeof(term), pat->p.str, false);
-      buf_addstr(buf, term);
+      compile_search_string(buf, "TEXT", pat->p.str);
       break;
     case MUTT_PAT_SERVERSEARCH:
       if (!(adata->capabilities & IMAP_CAP_X_GM_EXT_1))
@@ -184,9 +246,34 @@ static bool compile_search_self(const struct ImapAccountData *adata,
         mutt_error(_("Server-side custom search not supported: %s"), pat->p.str);
         return false;
       }
-      buf_addstr(buf, "X-GM-RAW ");
-      imap_quote_string(term, sizeof(term), pat->p.str, false);
-      buf_addstr(buf, term);
+      compile_search_string(buf, "X-GM-RAW", pat->p.str);
+      break;
+    case MUTT_PAT_SUBJECT:
+      compile_search_string(buf, "SUBJECT", pat->p.str);
+      break;
+    case MUTT_PAT_ID:
+      compile_search_string(buf, "HEADER Message-ID", pat->p.str);
+      break;
+    case MUTT_PAT_XLABEL:
+      compile_search_string(buf, "HEADER X-Label", pat->p.str);
+      break;
+    case MUTT_ALL:
+      buf_addstr(buf, "ALL");
+      break;
+    case MUTT_FLAG:
+      buf_addstr(buf, "FLAGGED");
+      break;
+    case MUTT_DELETED:
+      buf_addstr(buf, "DELETED");
+      break;
+    case MUTT_REPLIED:
+      buf_addstr(buf, "ANSWERED");
+      break;
+    case MUTT_READ:
+      buf_addstr(buf, "SEEN");
+      break;
+    case MUTT_UNREAD:
+      buf_addstr(buf, "UNSEEN");
       break;
   }
   return true;
@@ -195,34 +282,111 @@ static bool compile_search_self(const struct ImapAccountData *adata,
 /**
  * compile_search - Convert NeoMutt pattern to IMAP search
  * @param adata Imap Account data
- * @param pat Pattern to convert
- * @param buf Buffer for result
+ * @param pat   Pattern to convert
+ * @param exact Compile the entire pattern, not just the full-text parts
+ * @param buf   Buffer for result
  * @retval true  Success
  * @retval false Failure
  *
  * Convert neomutt Pattern to IMAP SEARCH command containing only elements
  * that require full-text search (neomutt already has what it needs for most
  * match types, and does a better job (eg server doesn't support regexes).
+ *
+ * If the whole pattern can be evaluated by the server, see
+ * check_pattern_exact(), then @a exact will compile all of it.
  */
 static bool compile_search(const struct ImapAccountData *adata,
-                           const struct Pattern *pat, struct Buffer *buf)
+                           const struct Pattern *pat, bool exact, struct Buffer *buf)
 {
-  if (!check_pattern(pat))
+  if (!exact && !check_pattern(pat))
     return true;
 
   if (pat->pat_not)
     buf_addstr(buf, "NOT ");
 
-  return pat->child ? compile_search_children(adata, pat, buf) :
+  return pat->child ? compile_search_children(adata, pat, exact, buf) :
                       compile_search_self(adata, pat, buf);
 }
 
+/**
+ * compile_search_date - Add a date search key
+ * @param buf Buffer for the resulting command
+ * @param key IMAP search key, e.g. "SENTSINCE"
+ * @param t   Timestamp
+ */
+static void compile_search_date(struct Buffer *buf, const char *key, time_t t)
+{
+  struct Buffer *date = buf_pool_get();
+
+  /* Only the DD-MMM-YYYY part is used by SEARCH */
+  mutt_date_make_imap(date, t);
+  buf_add_printf(buf, "%s %.11s ", key, buf_string(date));
+
+  buf_pool_release(&date);
+}
+
+/**
+ * compile_search_filter - Narrow down a full-text search
+ * @param adata Imap Account data
+ * @param m     Mailbox
+ * @param pat   Top-level pattern
+ * @param buf   Buffer for the resulting command
+ *
+ * The children of a top-level AND will still be checked locally, so any of
+ * them can be sent to the server, provided that the server's answer is
+ * a superset of ours.  This saves the server from searching the text of
+ * messages we're going to reject anyway.
+ *
+ * The server compares dates by day, in its own timezone, so the date ranges
+ * are widened by a couple of days.  The server's size includes the headers.
+ */
+static void compile_search_filter(const struct ImapAccountData *adata,
+                                  const struct Mailbox *m,
+                                  const struct Pattern *pat, struct Buffer *buf)
+{
+  if ((pat->op != MUTT_PAT_AND) || pat->pat_not)
+    return;
+
+  const time_t slack = 2 * 24 * 60 * 60;
+  const struct Pattern *c = NULL;
+  SLIST_FOREACH(c, pat->child, entries)
+  {
+    switch (c->op)
+    {
+      case MUTT_PAT_DATE:
+      case MUTT_PAT_DATE_RECEIVED:
+      {
+        if (c->pat_not || c->dynamic)
+          break;
+        const bool sent = (c->op == MUTT_PAT_DATE);
+        compile_search_date(buf, sent ? "SENTSINCE" : "SINCE", c->min - slack);
+        compile_search_date(buf, sent ? "SENTBEFORE" : "BEFORE", c->max + slack);
+        break;
+      }
+      case MUTT_PAT_SIZE:
+        if (!c->pat_not && (c->min > 0))
+          buf_add_printf(buf, "LARGER %ld ", c->min - 1);
+        break;
+      default:
+        if (!c->child && !check_pattern(c) && check_pattern_exact(m, c) &&
+            compile_search(adata, c, true, buf))
+        {
+          buf_addch(buf, ' ');
+        }
+        break;
+    }
+  }
+}
+
 /**
  * imap_search - Find messages in mailbox matching a pattern
  * @param m   Mailbox
  * @param pat Pattern to match
  * @retval true  Success
  * @retval false Failure
+ *
+ * If the server can evaluate the entire pattern, the result is marked in
+ * Pattern.server_eval and the pattern won't be evaluated locally.
  */
 bool imap_search(struct Mailbox *m, const struct PatternList *pat)
 {
@@ -234,6 +398,9 @@ bool imap_search(struct Mailbox *m, const struct PatternList *pat)
     e->matched = false;
   }
 
+  struct Pattern *root = SLIST_FIRST(pat);
+  root->server_eval = false;
+
   if (check_pattern_list(pat) == 0)
     return true;
 
@@ -241,9 +408,18 @@ bool imap_search(struct Mailbox *m, const struct PatternList *pat)
   buf_addstr(buf, "UID SEARCH ");
 
   struct ImapAccountData *adata = imap_adata_get(m);
-  const bool ok = compile_search(adata, SLIST_FIRST(pat), buf) &&
+  if (adata->capabilities & IMAP_CAP_ESEARCH)
+    buf_addstr(buf, "RETURN (ALL) ");
+
+  const bool exact = check_pattern_exact(m, root);
+  if (!exact)
+    compile_search_filter(adata, m, root, buf);
+
+  const bool ok = compile_search(adata, root, exact, buf) &&
                   (imap_exec(adata, buf_string(buf), IMAP_CMD_NO_FLAGS) == IMAP_EXEC_SUCCESS);
 
+  root->server_eval = ok && exact;
+
   buf_pool_release(&buf);
   return ok;
 }
@@ -270,3 +446,38 @@ void cmd_parse_search(struct ImapAccountData *adata, const char *s)
       e->matched = true;
   }
 }
+
+/**
+ * cmd_parse_esearch - Store ESEARCH response for later use
+ * @param adata Imap Account data
+ * @param s     Command string with search results
+ *
+ * e.g. `ESEARCH (TAG "a0012") UID ALL 4:19,21,28`
+ */
+void cmd_parse_esearch(struct ImapAccountData *adata, const char *s)
+{
+  struct ImapMboxData *mdata = adata->mailbox->mdata;
+
+  mutt_debug(LL_DEBUG2, "Handling ESEARCH\n");
+
+  /* Skip the search correlator and UID indicator, looking for the results */
+  while ((s = imap_next_word((char *) s)) && (*s != '\0'))
+  {
+    if (mutt_istr_startswith(s, "ALL ") == 0)
+      continue;
+
+    s = imap_next_word((char *) s);
+    char *seqset = mutt_strn_dup(s, strcspn(s, " "));
+    struct SeqsetIterator *iter = mutt_seqset_iterator_new(seqset);
+    unsigned int uid = 0;
+    while (mutt_seqset_iterator_next(iter, &uid) == 0)
+    {
+      struct Email *e = mutt_hash_int_find(mdata->uid_hash, uid);
+      if (e)
+        e->matched = true;
+    }
+    mutt_seqset_iterator_free(&iter);
+    FREE(&seqset);
+    break;
+  }
+}
@@ -346,6 +346,53 @@ void imap_hcache_close(struct ImapMboxData *mdata)
   hcache_close(&mdata->hcache);
 }
 
+/**
+ * hcache_flags_key - Get the header cache key of an Email's flags
+ * @param uid    UID of the Email
+ * @param key    Buffer for the key
+ * @param keylen Length of the buffer
+ * @retval num Length of the key
+ */
+static size_t hcache_flags_key(unsigned int uid, char *key, size_t keylen)
+{
+  return snprintf(key, keylen, "%u/FLAGS", uid);
+}
+
+/**
+ * hcache_get_flags - Apply the separately stored flags to an Email
+ * @param mdata Imap Mailbox data
+ * @param uid   UID of the Email
+ * @param e     Email from the header cache
+ *
+ * The record has the form: "UIDVALIDITY FLAGS KEYWORDS"
+ */
+static void hcache_get_flags(struct ImapMboxData *mdata, unsigned int uid, struct Email *e)
+{
+  char key[32] = { 0 };
+  size_t keylen = hcache_flags_key(uid, key, sizeof(key));
+  char *rec = hcache_fetch_raw_str(mdata->hcache, key, keylen);
+  if (!rec)
+    return;
+
+  uint32_t uidvalidity = 0;
+  unsigned int flags = 0;
+  int off = 0;
+  if ((sscanf(rec, "%u %u %n", &uidvalidity, &flags, &off) >= 2) &&
+      (uidvalidity == mdata->uidvalidity))
+  {
+    e->read = flags & (1 << 0);
+    e->old = flags & (1 << 1);
+    e->flagged = flags & (1 << 2);
+    e->replied = flags & (1 << 3);
+    e->expired = flags & (1 << 4);
+    e->superseded = flags & (1 << 5);
+    e->trash = flags & (1 << 6);
+    driver_tags_replace(&e->tags, rec + off);
+  }
+
+  FREE(&rec);
+}
+
 /**
  * imap_hcache_get - Get a header cache entry by its UID
  * @param mdata Imap Mailbox data
@@ -368,6 +415,9 @@ struct Email *imap_hcache_get(struct ImapMboxData *mdata, unsigned int uid)
     mutt_debug(LL_DEBUG3, "hcache uidvalidity mismatch: %u\n", hce.uidvalidity);
   }
 
+  if (hce.email)
+    hcache_get_flags(mdata, uid, hce.email);
+
   return hce.email;
 }
 
@@ -386,7 +436,47 @@ int imap_hcache_put(struct ImapMboxData *mdata, struct Email *e)
   char key[16] = { 0 };
 
   snprintf(key, sizeof(key), "%u", imap_edata_get(e)->uid);
-  return hcache_store_email(mdata->hcache, key, mutt_str_len(key), e, mdata->uidvalidity);
+  int rc = hcache_store_email(mdata->hcache, key, mutt_str_len(key), e, mdata->uidvalidity);
+
+  /* The Email record now has the latest flags */
+  char fkey[32] = { 0 };
+  size_t fkeylen = hcache_flags_key(imap_edata_get(e)->uid, fkey, sizeof(fkey));
+  hcache_delete_raw(mdata->hcache, fkey, fkeylen);
+
+  return rc;
+}
+
+/**
+ * imap_hcache_put_flags - Save an Email's flags in the header cache
+ * @param mdata Imap Mailbox data
+ * @param e     Email
+ * @retval  0 Success
+ * @retval -1 Failure
+ *
+ * Flags change far more often than headers, so they're saved in a small
+ * record of their own, instead of rewriting the whole Email.
+ * imap_hcache_get() applies it on top of the Email's record.
+ */
+int imap_hcache_put_flags(struct ImapMboxData *mdata, struct Email *e)
+{
+  if (!mdata->hcache)
+    return -1;
+
+  char key[32] = { 0 };
+  size_t keylen = hcache_flags_key(imap_edata_get(e)->uid, key, sizeof(key));
+
+  /* All the flags that hcache_store_email() would save */
+  const unsigned int flags = (e->read << 0) | (e->old << 1) | (e->flagged << 2) |
+                             (e->replied << 3) | (e->expired << 4) |
+                             (e->superseded << 5) | (e->trash << 6);
+
+  struct Buffer *rec = buf_pool_get();
+  buf_printf(rec, "%u %u ", mdata->uidvalidity, flags);
+  driver_tags_get_with_hidden(&e->tags, rec);
+
+  int rc = hcache_store_raw(mdata->hcache, key, keylen, rec->data, buf_len(rec));
+  buf_pool_release(&rec);
+  return rc;
 }
 
 /**
@@ -404,7 +494,13 @@ int imap_hcache_del(struct ImapMboxData *mdata, unsigned int uid)
   char key[16] = { 0 };
 
   snprintf(key, sizeof(key), "%u", uid);
-  return hcache_delete_email(mdata->hcache, key, mutt_str_len(key));
+  int rc = hcache_delete_email(mdata->hcache, key, mutt_str_len(key));
+
+  char fkey[32] = { 0 };
+  size_t fkeylen = hcache_flags_key(uid, fkey, sizeof(fkey));
+  hcache_delete_raw(mdata->hcache, fkey, fkeylen);
+
+  return rc;
 }
 
 /**
@@ -789,6 +789,111 @@ void change_folder_string(struct Menu *menu, struct Buffer *buf, int *oldcount,
   change_folder_mailbox(menu, m, oldcount, shared, read_only);
 }
 
+/**
+ * index_line_email_state - Summarise the flags of an Email
+ * @param e Email
+ * @retval num Bitmask of the Email's flags
+ *
+ * Any change to the flags that might be displayed in the Index changes the result.
+ */
+static uint32_t index_line_email_state(const struct Email *e)
+{
+  uint32_t state = 0;
+  int bit = 0;
+
+  state |= (uint32_t) e->attach_del << bit++;
+  state |= (uint32_t) e->changed << bit++;
+  state |= (uint32_t) e->collapsed << bit++;
+  state |= (uint32_t) e->deleted << bit++;
+  state |= (uint32_t) e->display_subject << bit++;
+  state |= (uint32_t) e->expired << bit++;
+  state |= (uint32_t) e->flagged << bit++;
+  state |= (uint32_t) e->matched << bit++;
+  state |= (uint32_t) e->old << bit++;
+  state |= (uint32_t) e->purge << bit++;
+  state |= (uint32_t) e->quasi_deleted << bit++;
+  state |= (uint32_t) e->read << bit++;
+  state |= (uint32_t) e->replied << bit++;
+  state |= (uint32_t) e->superseded << bit++;
+  state |= (uint32_t) e->tagged << bit++;
+  state |= (uint32_t) e->trash << bit++;
+  state |= (uint32_t) e->attach_valid << bit++;
+  state |= (uint32_t) e->recip_valid << bit++;
+
+  if (e->env)
+    state |= (uint32_t) e->env->changed << 24;
+
+  return state;
+}
+
+/**
+ * index_line_lookup - Find a cached Index line
+ * @param priv         Private Index data
+ * @param line         Line number
+ * @param e            Email to be formatted
+ * @param max_cols     Width of the line
+ * @param flags        Format flags, e.g. #MUTT_FORMAT_TREE
+ * @param msg_in_pager Message open in the Pager
+ * @retval ptr  Cache slot for the line
+ * @retval NULL The slot doesn't hold this line
+ */
+static struct IndexLine *index_line_lookup(struct IndexPrivateData *priv, int line,
+                                           struct Email *e, int max_cols,
+                                           MuttFormatFlags flags, int msg_in_pager)
+{
+  struct IndexLine *il = &priv->lines[line % INDEX_LINE_CACHE_SIZE];
+
+  if ((il->generation != priv->line_generation) || (il->email != e) ||
+      (il->max_cols != max_cols) || (il->flags != flags) ||
+      (il->msg_in_pager != msg_in_pager) || (il->msgno != e->msgno) ||
+      (il->vnum != e->vnum) || (il->score != e->score) ||
+      (il->num_hidden != e->num_hidden) || (il->security != e->security) ||
+      (il->changes != e->changes) || (il->state != index_line_email_state(e)) ||
+      !mutt_str_equal(il->tree, e->tree))
+  {
+    return NULL;
+  }
+
+  return il;
+}
+
+/**
+ * index_line_store - Save a formatted Index line in the cache
+ * @param priv         Private Index data
+ * @param line         Line number
+ * @param e            Email that was formatted
+ * @param max_cols     Width of the line
+ * @param flags        Format flags, e.g. #MUTT_FORMAT_TREE
+ * @param msg_in_pager Message open in the Pager
+ * @param buf          Formatted line
+ * @param rc           Return value of mutt_make_string()
+ */
+static void index_line_store(struct IndexPrivateData *priv, int line, struct Email *e,
+                             int max_cols, MuttFormatFlags flags, int msg_in_pager,
+                             const struct Buffer *buf, int rc)
+{
+  struct IndexLine *il = &priv->lines[line % INDEX_LINE_CACHE_SIZE];
+
+  il->len = buf_len(buf);
+  mutt_mem_realloc(&il->text, il->len + 1);
+  memcpy(il->text, buf_string(buf), il->len + 1);
+  mutt_str_replace(&il->tree, e->tree);
+
+  il->rc = rc;
+  il->generation = priv->line_generation;
+  il->email = e;
+  il->max_cols = max_cols;
+  il->flags = flags;
+  il->msg_in_pager = msg_in_pager;
+  il->msgno = e->msgno;
+  il->vnum = e->vnum;
+  il->score = e->score;
+  il->num_hidden = e->num_hidden;
+  il->security = e->security;
+  il->state = index_line_email_state(e);
+  il->changes = e->changes;
+}
+
 /**
  * index_make_entry - Format an Email for the Menu - Implements Menu::make_entry() - @ingroup menu_make_entry
  *
@@ -888,7 +993,27 @@ int index_make_entry(struct Menu *menu, int line, int max_cols, struct Buffer *b
     max_cols -= (mutt_strwidth(c_arrow_string) + 1);
   }
 
-  return mutt_make_string(buf, max_cols, c_index_format, m, msg_in_pager, e, flags, NULL);
+  if (!priv->lines)
+    priv->lines = mutt_mem_calloc(INDEX_LINE_CACHE_SIZE, sizeof(struct IndexLine));
+
+  /* A collapsed thread shows flags of the hidden Emails, e.g. %Z, %S,
+   * which the cache key doesn't cover */
+  const bool cacheable = !(e->collapsed && (e->num_hidden > 1));
+
+  struct IndexLine *il = NULL;
+  if (cacheable)
+    il = index_line_lookup(priv, line, e, max_cols, flags, msg_in_pager);
+  if (il)
+  {
+    buf_reset(buf);
+    buf_addstr_n(buf, il->text, il->len);
+    return il->rc;
+  }
+
+  int rc = mutt_make_string(buf, max_cols, c_index_format, m, msg_in_pager, e, flags, NULL);
+  if (cacheable)
+    index_line_store(priv, line, e, max_cols, flags, msg_in_pager, buf, rc);
+  return rc;
 }
 
 /**
@@ -58,6 +58,7 @@
  * | #NT_MENU              | index_menu_observer()   |
  * | #NT_SCORE             | index_score_observer()  |
  * | #NT_SUBJRX            | index_subjrx_observer() |
+ * | #NT_TIMEOUT           | index_timeout_observer() |
  * | #NT_WINDOW            | index_window_observer() |
  * | MuttWindow::recalc()  | index_recalc()          |
  * | MuttWindow::repaint() | index_repaint()         |
@@ -75,6 +76,7 @@
 #include "email/lib.h"
 #include "core/lib.h"
 #include "gui/lib.h"
+#include "lib.h"
 #include "attach/lib.h"
 #include "color/lib.h"
 #include "menu/lib.h"
@@ -229,6 +231,8 @@ static int index_altern_observer(struct NotifyCallback *nc)
   struct MuttWindow *win = nc->global_data;
   struct MuttWindow *dlg = dialog_find(win);
   struct IndexSharedData *shared = dlg->wdata;
+  struct Menu *menu = win->wdata;
+  index_line_cache_flush(menu->mdata);
 
   mutt_alternates_reset(shared->mailbox_view);
   mutt_debug(LL_DEBUG5, "alternates done\n");
@@ -248,6 +252,8 @@ static int index_attach_observer(struct NotifyCallback *nc)
   struct MuttWindow *win = nc->global_data;
   struct MuttWindow *dlg = dialog_find(win);
   struct IndexSharedData *shared = dlg->wdata;
+  struct Menu *menu = win->wdata;
+  index_line_cache_flush(menu->mdata);
 
   mutt_attachments_reset(shared->mailbox_view);
   mutt_debug(LL_DEBUG5, "attachments done\n");
@@ -395,6 +401,10 @@ static int index_config_observer(struct NotifyCallback *nc)
 
   struct MuttWindow *win = nc->global_data;
 
+  // Any config variable might be used by the $index_format
+  struct Menu *menu = win->wdata;
+  index_line_cache_flush(menu->mdata);
+
   if (!config_check_sort(ev_c->name) && !config_check_index(ev_c->name))
     return 0;
 
@@ -437,6 +447,10 @@ static int index_global_observer(struct NotifyCallback *nc)
   if (!dlg)
     return 0;
 
+  // Any command might change what the $index_format displays
+  struct Menu *menu = win->wdata;
+  index_line_cache_flush(menu->mdata);
+
   struct IndexSharedData *shared = dlg->wdata;
   mutt_check_rescore(shared->mailbox);
 
@@ -459,6 +473,9 @@ static int index_index_observer(struct NotifyCallback *nc)
   mutt_debug(LL_DEBUG5, "index done, request WA_RECALC\n");
 
   struct IndexPrivateData *priv = menu->mdata;
+  // Changes to the current Email are caught by the line cache's key
+  if (nc->event_subtype & (NT_INDEX_MVIEW | NT_INDEX_MAILBOX))
+    index_line_cache_flush(priv);
   struct IndexSharedData *shared = priv->shared;
   if (shared && shared->mailbox)
     menu->max = shared->mailbox->vcount;
@@ -535,12 +552,34 @@ static int index_subjrx_observer(struct NotifyCallback *nc)
   struct MuttWindow *win = nc->global_data;
   struct MuttWindow *dlg = dialog_find(win);
   struct IndexSharedData *shared = dlg->wdata;
+  struct Menu *menu = win->wdata;
+  index_line_cache_flush(menu->mdata);
 
   subjrx_clear_mods(shared->mailbox_view);
   mutt_debug(LL_DEBUG5, "subjectrx done\n");
   return 0;
 }
 
+/**
+ * index_timeout_observer - Notification that a timeout has occurred - Implements ::observer_t - @ingroup observer_api
+ *
+ * Time may have moved on enough to change relative dates in the Index.
+ */
+static int index_timeout_observer(struct NotifyCallback *nc)
+{
+  if (nc->event_type != NT_TIMEOUT)
+    return 0;
+  if (!nc->global_data)
+    return -1;
+
+  struct MuttWindow *win = nc->global_data;
+  struct Menu *menu = win->wdata;
+  index_line_cache_flush(menu->mdata);
+
+  mutt_debug(LL_DEBUG5, "timeout done\n");
+  return 0;
+}
+
 /**
  * index_window_observer - Notification that a Window has changed - Implements ::observer_t - @ingroup observer_api
  */
@@ -575,6 +614,7 @@ static int index_window_observer(struct NotifyCallback *nc)
   notify_observer_remove(menu->notify, index_menu_observer, win);
   notify_observer_remove(NeoMutt->notify, index_score_observer, win);
   notify_observer_remove(NeoMutt->notify, index_subjrx_observer, win);
+  notify_observer_remove(NeoMutt->notify_timeout, index_timeout_observer, win);
   notify_observer_remove(win->notify, index_window_observer, win);
 
   mutt_debug(LL_DEBUG5, "window delete done\n");
@@ -668,6 +708,7 @@ struct MuttWindow *index_window_new(struct IndexPrivateData *priv)
   notify_observer_add(menu->notify, NT_MENU, index_menu_observer, win);
   notify_observer_add(NeoMutt->notify, NT_SCORE, index_score_observer, win);
   notify_observer_add(NeoMutt->notify, NT_SUBJRX, index_subjrx_observer, win);
+  notify_observer_add(NeoMutt->notify_timeout, NT_TIMEOUT, index_timeout_observer, win);
   notify_observer_add(win->notify, NT_WINDOW, index_window_observer, win);
 
   return win;
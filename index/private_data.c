@@ -38,9 +38,32 @@ void index_private_data_free(struct MuttWindow *win, void **ptr)
   if (!ptr || !*ptr)
     return;
 
+  struct IndexPrivateData *priv = *ptr;
+  if (priv->lines)
+  {
+    for (int i = 0; i < INDEX_LINE_CACHE_SIZE; i++)
+    {
+      FREE(&priv->lines[i].text);
+      FREE(&priv->lines[i].tree);
+    }
+    FREE(&priv->lines);
+  }
+
   FREE(ptr);
 }
 
+/**
+ * index_line_cache_flush - Invalidate all the cached Index lines
+ * @param priv Private Index data
+ */
+void index_line_cache_flush(struct IndexPrivateData *priv)
+{
+  if (!priv)
+    return;
+
+  priv->line_generation++;
+}
+
 /**
  * index_private_data_new - Create new Index Data
  * @param shared Shared Index data
@@ -52,6 +75,7 @@ struct IndexPrivateData *index_private_data_new(struct IndexSharedData *shared)
 
   priv->shared = shared;
   priv->oldcount = -1;
+  priv->line_generation = 1;
 
   return priv;
 }
@@ -24,10 +24,42 @@
 #define MUTT_INDEX_PRIVATE_DATA_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+struct Email;
 struct IndexSharedData;
 struct MuttWindow;
 
+/// Number of formatted lines kept by the Index's line cache
+#define INDEX_LINE_CACHE_SIZE 256
+
+/**
+ * struct IndexLine - A formatted line of the Index
+ *
+ * The line is reused only if everything it was formatted from still matches.
+ */
+struct IndexLine
+{
+  char *text;                ///< Formatted line
+  size_t len;                ///< Length of text
+  int rc;                    ///< Return value of mutt_make_string()
+  unsigned int generation;   ///< IndexPrivateData.line_generation when formatted
+
+  struct Email *email;       ///< Email that was formatted
+  int max_cols;              ///< Width of the line
+  uint8_t flags;             ///< Format flags, e.g. #MUTT_FORMAT_TREE
+  int msg_in_pager;          ///< Message open in the Pager
+  int msgno;                 ///< Email's number
+  int vnum;                  ///< Email's virtual number
+  int score;                 ///< Email's score
+  size_t num_hidden;         ///< Email's hidden thread count
+  uint16_t security;         ///< Email's security flags
+  uint32_t state;            ///< Email's flags, see index_line_email_state()
+  unsigned int changes;      ///< Email's change count, Email.changes
+  char *tree;                ///< Email's thread tree
+};
+
 /**
  * struct IndexPrivateData - Private state data for the Index
  */
@@ -40,8 +72,12 @@ struct IndexPrivateData
   struct IndexSharedData *shared; ///< Shared Index data
   struct Menu *menu;              ///< Menu controlling the index
   struct MuttWindow *win_index;   ///< Window for the Index
+
+  struct IndexLine *lines;        ///< Cache of formatted lines, indexed by line number
+  unsigned int line_generation;   ///< Incremented to invalidate the cached lines
 };
 
+void                     index_line_cache_flush (struct IndexPrivateData *priv);
 void                     index_private_data_free(struct MuttWindow *win, void **ptr);
 struct IndexPrivateData *index_private_data_new (struct IndexSharedData *shared);
 
@@ -153,6 +153,7 @@
 #include "conn/lib.h"
 #include "gui/lib.h"
 #include "attach/lib.h"
+#include "bcache/lib.h"
 #include "browser/lib.h"
 #include "color/lib.h"
 #include "history/lib.h"
@@ -379,6 +380,7 @@ static int start_curses(void)
   nonl();
   typeahead(-1); /* simulate smooth scrolling */
   meta(stdscr, true);
+  idlok(stdscr, true); /* let curses scroll the screen, rather than repaint it */
   init_extended_keys();
   /* Now that curses is set up, we drop back to normal screen mode.
    * This simplifies displaying error messages to the user.
@@ -1479,6 +1481,7 @@ main_exit:
   buf_pool_cleanup();
   envlist_free(&EnvList);
   mutt_browser_cleanup();
+  mutt_bcache_cleanup();
   external_cleanup();
   menu_cleanup();
   crypt_cleanup();
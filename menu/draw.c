@@ -32,6 +32,7 @@
 #include <stddef.h>
 #include <string.h>
 #include <wchar.h>
+#include "private.h"
 #include "mutt/lib.h"
 #include "config/lib.h"
 #include "email/lib.h"
@@ -301,14 +302,95 @@ static void menu_pad_string(struct Menu *menu, struct Buffer *buf)
   }
 }
 
+/**
+ * menu_rows_invalidate - Forget what is on screen
+ * @param menu Current Menu
+ *
+ * The next redraw will paint every row of the Menu.
+ */
+void menu_rows_invalidate(struct Menu *menu)
+{
+  struct MenuRow *mr = NULL;
+  ARRAY_FOREACH(mr, &menu->rows)
+  {
+    FREE(&mr->text);
+  }
+  ARRAY_FREE(&menu->rows);
+}
+
+/**
+ * menu_row_invalidate - Forget what is on one row of the screen
+ * @param menu Current Menu
+ * @param line Menu line
+ */
+static void menu_row_invalidate(struct Menu *menu, int line)
+{
+  if (line < menu->top)
+    return;
+
+  struct MenuRow *mr = ARRAY_GET(&menu->rows, line - menu->top);
+  if (mr)
+    mr->valid = false;
+}
+
+/**
+ * menu_row_unchanged - Is a row of the screen already showing this?
+ * @param menu    Current Menu
+ * @param row     Screen row
+ * @param line    Menu line, -1 if blank
+ * @param current Line is the current line
+ * @param ac      Colour of the line
+ * @param text    Formatted text of the line
+ * @retval true The row doesn't need to be painted
+ */
+static bool menu_row_unchanged(struct Menu *menu, int row, int line, bool current,
+                               const struct AttrColor *ac, const char *text)
+{
+  const struct MenuRow *mr = ARRAY_GET(&menu->rows, row);
+
+  return mr && mr->valid && (mr->line == line) && (mr->current == current) &&
+         (mr->color == ac) && mutt_str_equal(mr->text, text);
+}
+
+/**
+ * menu_row_save - Remember what has been painted on a row of the screen
+ * @param menu    Current Menu
+ * @param row     Screen row
+ * @param line    Menu line, -1 if blank
+ * @param current Line is the current line
+ * @param ac      Colour of the line
+ * @param text    Formatted text of the line
+ */
+static void menu_row_save(struct Menu *menu, int row, int line, bool current,
+                          const struct AttrColor *ac, const char *text)
+{
+  struct MenuRow *mr = ARRAY_GET(&menu->rows, row);
+  if (!mr)
+  {
+    struct MenuRow mr_new = { 0 };
+    ARRAY_SET(&menu->rows, row, mr_new);
+    mr = ARRAY_GET(&menu->rows, row);
+  }
+
+  mr->valid = true;
+  mr->line = line;
+  mr->current = current;
+  mr->color = ac;
+  mutt_str_replace(&mr->text, text);
+}
+
 /**
  * menu_redraw_full - Force the redraw of the Menu
  * @param menu Current Menu
+ *
+ * Rows that are known to be on screen are left alone; menu_redraw_index()
+ * will only paint the rows that have changed.
  */
 void menu_redraw_full(struct Menu *menu)
 {
   mutt_curses_set_color_by_id(MT_COLOR_NORMAL);
-  mutt_window_clear(menu->win);
+  if (ARRAY_EMPTY(&menu->rows))
+    mutt_window_clear(menu->win);
 
   menu->page_len = menu->win->state.rows;
 
@@ -330,6 +412,7 @@ void menu_redraw_index(struct Menu *menu)
   struct AttrColor *ac_ind = simple_color_get(MT_COLOR_INDICATOR);
   for (int i = menu->top; i < (menu->top + menu->page_len); i++)
   {
+    const int row = i - menu->top;
     if (i < menu->max)
     {
       ac = menu->color(menu, i);
@@ -338,8 +421,13 @@ void menu_redraw_index(struct Menu *menu)
       menu->make_entry(menu, i, menu->win->state.cols, buf);
       menu_pad_string(menu, buf);
 
+      // Only paint the rows that have changed
+      if (menu_row_unchanged(menu, row, i, (i == menu->current), ac, buf_string(buf)))
+        continue;
+      menu_row_save(menu, row, i, (i == menu->current), ac, buf_string(buf));
+
       mutt_curses_set_color(ac);
-      mutt_window_move(menu->win, 0, i - menu->top);
+      mutt_window_move(menu->win, 0, row);
 
       if (i == menu->current)
         mutt_curses_set_color(ac_ind);
@@ -370,8 +458,12 @@ void menu_redraw_index(struct Menu *menu)
     }
     else
     {
+      if (menu_row_unchanged(menu, row, -1, false, NULL, NULL))
+        continue;
+      menu_row_save(menu, row, -1, false, NULL, NULL);
+
       mutt_curses_set_color_by_id(MT_COLOR_NORMAL);
-      mutt_window_clearline(menu->win, i - menu->top);
+      mutt_window_clearline(menu->win, row);
     }
   }
   mutt_curses_set_color_by_id(MT_COLOR_NORMAL);
@@ -387,6 +479,9 @@ void menu_redraw_motion(struct Menu *menu)
 {
   struct Buffer *buf = buf_pool_get();
 
+  menu_row_invalidate(menu, menu->old_current);
+  menu_row_invalidate(menu, menu->current);
+
   /* Note: menu->color() for the index can end up retrieving a message
    * over imap (if matching against ~h for instance).  This can
    * generate status messages.  So we want to call it *before* we
@@ -446,6 +541,8 @@ void menu_redraw_current(struct Menu *menu)
   struct Buffer *buf = buf_pool_get();
   const struct AttrColor *ac = menu->color(menu, menu->current);
 
+  menu_row_invalidate(menu, menu->current);
+
   mutt_window_move(menu->win, 0, menu->current - menu->top);
   menu->make_entry(menu, menu->current, menu->win->state.cols, buf);
   menu_pad_string(menu, buf);
@@ -68,6 +68,19 @@ enum ExpandoDataMenu
   ED_MEN_PERCENTAGE,           ///< Menu.top, ...
 };
 
+/**
+ * struct MenuRow - What was last drawn on a row of a Menu
+ */
+struct MenuRow
+{
+  bool valid;                    ///< Row is known to be on screen
+  int line;                      ///< Menu line drawn on the row, -1 if blank
+  bool current;                  ///< Row was drawn as the current line
+  const struct AttrColor *color; ///< Colour of the row
+  char *text;                    ///< Formatted text of the row
+};
+ARRAY_HEAD(MenuRowArray, struct MenuRow);
+
 /**
  * @defgroup menu_api Menu API
  *
@@ -92,6 +105,8 @@ struct Menu
   int search_dir;         ///< Direction of search
   int num_tagged;         ///< Number of tagged entries
 
+  struct MenuRowArray rows; ///< What is on screen, used by menu_redraw_index()
+
   /**
    * @defgroup menu_make_entry make_entry()
    * @ingroup menu_api
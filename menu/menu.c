@@ -119,6 +119,7 @@ void menu_free(struct Menu **ptr)
   struct Menu *menu = *ptr;
 
   notify_free(&menu->notify);
+  menu_rows_invalidate(menu);
 
   if (menu->mdata_free && menu->mdata)
     menu->mdata_free(menu, &menu->mdata); // Custom function to free private data
@@ -28,6 +28,7 @@
 
 #include "config.h"
 #include <stddef.h>
+#include "private.h"
 #include "mutt/lib.h"
 #include "config/lib.h"
 #include "core/lib.h"
@@ -57,6 +58,7 @@ static int menu_color_observer(struct NotifyCallback *nc)
   struct Menu *menu = nc->global_data;
   struct MuttWindow *win = menu->win;
 
+  menu_rows_invalidate(menu);
   menu->redraw = MENU_REDRAW_FULL;
   win->actions |= WA_REPAINT;
   mutt_debug(LL_DEBUG5, "color done, request WA_REPAINT, MENU_REDRAW_FULL\n");
@@ -84,6 +86,7 @@ static int menu_config_observer(struct NotifyCallback *nc)
   struct Menu *menu = nc->global_data;
   menu_adjust(menu);
 
+  menu_rows_invalidate(menu);
   menu->redraw |= MENU_REDRAW_FULL;
   menu->win->actions |= WA_RECALC;
 
@@ -110,6 +113,7 @@ static int menu_window_observer(struct NotifyCallback *nc)
   if (nc->event_subtype == NT_WINDOW_STATE)
   {
     menu->page_len = win->state.rows;
+    menu_rows_invalidate(menu);
     menu->redraw |= MENU_REDRAW_FULL;
 
     win->actions |= WA_RECALC | WA_REPAINT;
@@ -34,5 +34,6 @@ void         menu_free(struct Menu **ptr);
 struct Menu *menu_new(enum MenuType type, struct MuttWindow *win, struct ConfigSubset *sub);
 
 void menu_add_observers   (struct Menu *menu);
+void menu_rows_invalidate (struct Menu *menu);
 
 #endif /* MUTT_MENU_PRIVATE_H */
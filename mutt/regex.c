@@ -40,6 +40,7 @@
 #include "config/types.h"
 #include "atoi.h"
 #include "buffer.h"
+#include "hash.h"
 #include "logging2.h"
 #include "mbyte.h"
 #include "memory.h"
@@ -143,6 +144,11 @@ int mutt_regexlist_add(struct RegexList *rl, const char *str, uint16_t flags,
   if (!rl || !str || (*str == '\0'))
     return 0;
 
+  /* check to make sure the item is not already on this rl,
+   * before paying for compiling it */
+  if (rl->index && mutt_hash_find(rl->index, str))
+    return 0;
+
   struct Regex *rx = mutt_regex_compile(str, flags);
   if (!rx)
   {
@@ -150,24 +156,13 @@ int mutt_regexlist_add(struct RegexList *rl, const char *str, uint16_t flags,
     return -1;
   }
 
-  /* check to make sure the item is not already on this rl */
-  struct RegexNode *np = NULL;
-  STAILQ_FOREACH(np, rl, entries)
-  {
-    if (mutt_istr_equal(rx->pattern, np->regex->pattern))
-      break; /* already on the rl */
-  }
+  struct RegexNode *np = mutt_regexlist_new();
+  np->regex = rx;
+  STAILQ_INSERT_TAIL(&rl->head, np, entries);
 
-  if (np)
-  {
-    mutt_regex_free(&rx);
-  }
-  else
-  {
-    np = mutt_regexlist_new();
-    np->regex = rx;
-    STAILQ_INSERT_TAIL(rl, np, entries);
-  }
+  if (!rl->index)
+    rl->index = mutt_hash_new(127, MUTT_HASH_STRCASECMP);
+  mutt_hash_insert(rl->index, rx->pattern, np);
 
   return 0;
 }
@@ -182,13 +177,14 @@ void mutt_regexlist_free(struct RegexList *rl)
     return;
 
   struct RegexNode *np = NULL, *tmp = NULL;
-  STAILQ_FOREACH_SAFE(np, rl, entries, tmp)
+  STAILQ_FOREACH_SAFE(np, &rl->head, entries, tmp)
   {
-    STAILQ_REMOVE(rl, np, RegexNode, entries);
+    STAILQ_REMOVE(&rl->head, np, RegexNode, entries);
     mutt_regex_free(&np->regex);
     FREE(&np);
   }
-  STAILQ_INIT(rl);
+  STAILQ_INIT(&rl->head);
+  mutt_hash_free(&rl->index);
 }
 
 /**
@@ -202,7 +198,7 @@ bool mutt_regexlist_match(struct RegexList *rl, const char *str)
   if (!rl || !str)
     return false;
   struct RegexNode *np = NULL;
-  STAILQ_FOREACH(np, rl, entries)
+  STAILQ_FOREACH(np, &rl->head, entries)
   {
     if (mutt_regex_match(np->regex, str))
     {
@@ -245,11 +241,12 @@ int mutt_regexlist_remove(struct RegexList *rl, const char *str)
 
   int rc = -1;
   struct RegexNode *np = NULL, *tmp = NULL;
-  STAILQ_FOREACH_SAFE(np, rl, entries, tmp)
+  STAILQ_FOREACH_SAFE(np, &rl->head, entries, tmp)
   {
     if (mutt_istr_equal(str, np->regex->pattern))
     {
-      STAILQ_REMOVE(rl, np, RegexNode, entries);
+      STAILQ_REMOVE(&rl->head, np, RegexNode, entries);
+      mutt_hash_delete(rl->index, np->regex->pattern, np);
       mutt_regex_free(&np->regex);
       FREE(&np);
       rc = 0;
@@ -31,6 +31,7 @@
 #include "queue.h"
 
 struct Buffer;
+struct HashTable;
 
 /* This is a non-standard option supported by Solaris 2.5.x
  * which allows patterns of the form \<...\> */
@@ -96,7 +97,19 @@ struct RegexNode
   struct Regex *regex;             ///< Regex containing a regular expression
   STAILQ_ENTRY(RegexNode) entries; ///< Linked list
 };
-STAILQ_HEAD(RegexList, RegexNode);
+STAILQ_HEAD(RegexNodeList, RegexNode);
+
+/**
+ * struct RegexList - List of regular expressions
+ */
+struct RegexList
+{
+  struct RegexNodeList head; ///< List of RegexNodes
+  struct HashTable *index;   ///< Nodes keyed by pattern, to find duplicates quickly
+};
+
+/// Static initializer for a RegexList
+#define REGEXLIST_INITIALIZER(rl) { STAILQ_HEAD_INITIALIZER((rl).head), NULL }
 
 /**
  * struct Replace - List of regular expressions
@@ -626,6 +626,12 @@ static struct ConfigDef MainVars[] = {
   { "message_cache_dir", DT_PATH|D_PATH_DIR, 0, 0, NULL,
     "(imap/pop) Directory for the message cache"
   },
+  { "message_cache_shared", DT_BOOL, false, 0, NULL,
+    "(imap) Store only one copy of messages found in several mailboxes"
+  },
+  { "message_cache_size", DT_LONG|D_INTEGER_NOT_NEGATIVE, 0, 0, NULL,
+    "(imap/pop) Maximum total size of the message caches, in bytes"
+  },
   { "message_format", DT_EXPANDO|D_NOT_EMPTY, IP "%s", IP &IndexFormatDef, NULL,
     "printf-like format string for listing attached messages"
   },
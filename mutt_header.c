@@ -119,6 +119,7 @@ static bool label_message(struct Mailbox *m, struct Email *e, char *new_label)
 
   e->changed = true;
   e->env->changed |= MUTT_ENV_CHANGED_XLABEL;
+  e->changes++;
   return true;
 }
 
@@ -47,6 +47,21 @@
 #include "protos.h"
 #include "sort.h"
 
+/// Cached value of $collapse_flagged
+static struct ConfigHandle CachedCollapseFlagged = CONFIG_HANDLE("collapse_flagged");
+/// Cached value of $collapse_unread
+static struct ConfigHandle CachedCollapseUnread = CONFIG_HANDLE("collapse_unread");
+/// Cached value of $hide_thread_subject
+static struct ConfigHandle CachedHideThreadSubject = CONFIG_HANDLE("hide_thread_subject");
+/// Cached value of $sort
+static struct ConfigHandle CachedSort = CONFIG_HANDLE("sort");
+/// Cached value of $sort_re
+static struct ConfigHandle CachedSortRe = CONFIG_HANDLE("sort_re");
+/// Cached value of $thread_received
+static struct ConfigHandle CachedThreadReceived = CONFIG_HANDLE("thread_received");
+/// Cached value of $use_threads
+static struct ConfigHandle CachedUseThreads = CONFIG_HANDLE("use_threads");
+
 /**
  * UseThreadsMethods - Choices for '$use_threads' for the index
  */
@@ -81,8 +96,8 @@ const struct EnumDef UseThreadsTypeDef = {
  */
 enum UseThreads mutt_thread_style(void)
 {
-  const unsigned char c_use_threads = cs_subset_enum(NeoMutt->sub, "use_threads");
-  const enum SortType c_sort = cs_subset_sort(NeoMutt->sub, "sort");
+  const unsigned char c_use_threads = cc_enum(&CachedUseThreads);
+  const enum SortType c_sort = cc_sort(&CachedSort);
   if (c_use_threads > UT_FLAT)
     return c_use_threads;
   if ((c_sort & SORT_MASK) != SORT_THREADS)
@@ -137,7 +152,7 @@ static bool need_display_subject(struct Email *e)
   struct MuttThread *tree = e->thread;
 
   /* if the user disabled subject hiding, display it */
-  const bool c_hide_thread_subject = cs_subset_bool(NeoMutt->sub, "hide_thread_subject");
+  const bool c_hide_thread_subject = cc_bool(&CachedHideThreadSubject);
   if (!c_hide_thread_subject)
     return true;
 
@@ -528,8 +543,8 @@ static void make_subject_list(struct ListHead *subjects, struct MuttThread *cur,
   time_t thisdate;
   int rc = 0;
 
-  const bool c_thread_received = cs_subset_bool(NeoMutt->sub, "thread_received");
-  const bool c_sort_re = cs_subset_bool(NeoMutt->sub, "sort_re");
+  const bool c_thread_received = cc_bool(&CachedThreadReceived);
+  const bool c_sort_re = cc_bool(&CachedSortRe);
   while (true)
   {
     while (!cur->message)
@@ -590,7 +605,7 @@ static struct MuttThread *find_subject(struct Mailbox *m, struct MuttThread *cur
   make_subject_list(&subjects, cur, &date);
 
   struct ListNode *np = NULL;
-  const bool c_thread_received = cs_subset_bool(NeoMutt->sub, "thread_received");
+  const bool c_thread_received = cc_bool(&CachedThreadReceived);
   STAILQ_FOREACH(np, &subjects, entries)
   {
     for (he = mutt_hash_find_bucket(m->subj_hash, np->data); he; he = he->next)
@@ -1816,8 +1831,8 @@ void mutt_thread_collapse(struct ThreadsContext *tctx, bool collapse)
  */
 bool mutt_thread_can_collapse(struct Email *e)
 {
-  const bool c_collapse_flagged = cs_subset_bool(NeoMutt->sub, "collapse_flagged");
-  const bool c_collapse_unread = cs_subset_bool(NeoMutt->sub, "collapse_unread");
+  const bool c_collapse_flagged = cc_bool(&CachedCollapseFlagged);
+  const bool c_collapse_unread = cc_bool(&CachedCollapseUnread);
   return (c_collapse_unread || !mutt_thread_contains_unread(e)) &&
          (c_collapse_flagged || !mutt_thread_contains_flagged(e));
 }
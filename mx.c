@@ -1297,7 +1297,11 @@ int mx_tags_commit(struct Mailbox *m, struct Email *e, const char *tags)
     return -1;
 
   if (m->mx_ops->tags_commit)
-    return m->mx_ops->tags_commit(m, e, tags);
+  {
+    int rc = m->mx_ops->tags_commit(m, e, tags);
+    e->changes++;
+    return rc;
+  }
 
   mutt_message(_("Folder doesn't support tagging, aborting"));
   return -1;
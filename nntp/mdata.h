@@ -45,6 +45,9 @@ struct NntpMboxData
   bool deleted      : 1;
   unsigned int newsrc_len;
   struct NewsrcEntry *newsrc_ent;
+  char *newsrc_line;                ///< Formatted .newsrc line, made from newsrc_saved
+  unsigned int newsrc_saved_len;    ///< Number of entries in newsrc_saved
+  struct NewsrcEntry *newsrc_saved; ///< Copy of newsrc_ent when newsrc_line was made
   struct NntpAccountData *adata;
   struct NntpAcache acache[NNTP_ACACHE_LEN];
   struct BodyCache *bcache;
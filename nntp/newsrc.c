@@ -156,6 +156,54 @@ void nntp_group_unread_stat(struct NntpMboxData *mdata)
   }
 }
 
+/**
+ * newsrc_line_update - Refresh the .newsrc line of a newsgroup
+ * @param mdata NNTP Mailbox data
+ * @retval true The line was made again
+ *
+ * The line is only formatted again if the group's entries or subscription
+ * have changed since it was last made.
+ */
+static bool newsrc_line_update(struct NntpMboxData *mdata)
+{
+  const size_t glen = mutt_str_len(mdata->group);
+  const char mark = mdata->subscribed ? ':' : '!';
+  if (mdata->newsrc_line && (mdata->newsrc_line[glen] == mark) &&
+      (mdata->newsrc_saved_len == mdata->newsrc_len) &&
+      (memcmp(mdata->newsrc_saved, mdata->newsrc_ent,
+              mdata->newsrc_len * sizeof(struct NewsrcEntry)) == 0))
+  {
+    return false;
+  }
+
+  struct Buffer *buf = buf_pool_get();
+  buf_printf(buf, "%s%c ", mdata->group, mark);
+  for (unsigned int j = 0; j < mdata->newsrc_len; j++)
+  {
+    if (j)
+      buf_addch(buf, ',');
+    if (mdata->newsrc_ent[j].first == mdata->newsrc_ent[j].last)
+    {
+      buf_add_printf(buf, ANUM_FMT, mdata->newsrc_ent[j].first);
+    }
+    else if (mdata->newsrc_ent[j].first < mdata->newsrc_ent[j].last)
+    {
+      buf_add_printf(buf, ANUM_FMT "-" ANUM_FMT, mdata->newsrc_ent[j].first,
+                     mdata->newsrc_ent[j].last);
+    }
+  }
+  buf_addch(buf, '\n');
+  mutt_str_replace(&mdata->newsrc_line, buf_string(buf));
+  buf_pool_release(&buf);
+
+  FREE(&mdata->newsrc_saved);
+  const size_t size = mdata->newsrc_len * sizeof(struct NewsrcEntry);
+  mdata->newsrc_saved = mutt_mem_malloc(MAX(size, 1));
+  memcpy(mdata->newsrc_saved, mdata->newsrc_ent, size);
+  mdata->newsrc_saved_len = mdata->newsrc_len;
+  return true;
+}
+
 /**
  * nntp_newsrc_parse - Parse .newsrc file
  * @param adata NNTP server
@@ -224,6 +272,7 @@ int nntp_newsrc_parse(struct NntpAccountData *adata)
     mdata->subscribed = false;
     mdata->newsrc_len = 0;
     FREE(&mdata->newsrc_ent);
+    FREE(&mdata->newsrc_line);
   }
 
   line = mutt_mem_malloc(st.st_size + 1);
@@ -289,6 +338,7 @@ int nntp_newsrc_parse(struct NntpAccountData *adata)
       mdata->last_message = mdata->newsrc_ent[j - 1].last;
     mdata->newsrc_len = j;
     mutt_mem_realloc(&mdata->newsrc_ent, j * sizeof(struct NewsrcEntry));
+    newsrc_line_update(mdata);
     nntp_group_unread_stat(mdata);
     mutt_debug(LL_DEBUG2, "%s\n", mdata->group);
   }
@@ -385,6 +435,37 @@ void nntp_newsrc_gen_entries(struct Mailbox *m)
   }
 }
 
+/**
+ * file_matches - Does a file already have these contents?
+ * @param filename File to check
+ * @param buf      Expected contents
+ * @retval true The file's contents match
+ */
+static bool file_matches(const char *filename, const char *buf)
+{
+  struct stat st = { 0 };
+  const size_t len = strlen(buf);
+  if ((stat(filename, &st) != 0) || ((size_t) st.st_size != len))
+    return false;
+
+  FILE *fp = mutt_file_fopen(filename, "r");
+  if (!fp)
+    return false;
+
+  bool match = true;
+  char chunk[8192];
+  size_t off = 0;
+  size_t n;
+  while (match && ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0))
+  {
+    match = ((off + n) <= len) && (memcmp(buf + off, chunk, n) == 0);
+    off += n;
+  }
+  mutt_file_fclose(&fp);
+
+  return match && (off == len);
+}
+
 /**
  * update_file - Update file with new contents
  * @param filename File to update
@@ -449,49 +530,53 @@ int nntp_newsrc_update(struct NntpAccountData *adata)
 
   int rc = -1;
 
-  size_t buflen = 10240;
-  char *buf = mutt_mem_calloc(1, buflen);
-  size_t off = 0;
-
-  /* we will generate full newsrc here */
+  /* only the lines of groups that have changed are formatted again */
+  bool changed = false;
+  size_t len = 0;
   for (unsigned int i = 0; i < adata->groups_num; i++)
   {
     struct NntpMboxData *mdata = adata->groups_list[i];
-
-    if (!mdata || !mdata->newsrc_ent)
+    if (!mdata)
       continue;
 
-    /* write newsgroup name */
-    if ((off + strlen(mdata->group) + 3) > buflen)
+    if (!mdata->newsrc_ent)
     {
-      buflen *= 2;
-      mutt_mem_realloc(&buf, buflen);
-    }
-    snprintf(buf + off, buflen - off, "%s%c ", mdata->group, mdata->subscribed ? ':' : '!');
-    off += strlen(buf + off);
-
-    /* write entries */
-    for (unsigned int j = 0; j < mdata->newsrc_len; j++)
-    {
-      if ((off + 1024) > buflen)
+      if (mdata->newsrc_line)
       {
-        buflen *= 2;
-        mutt_mem_realloc(&buf, buflen);
+        FREE(&mdata->newsrc_line);
+        changed = true;
       }
-      if (j)
-        buf[off++] = ',';
-      if (mdata->newsrc_ent[j].first == mdata->newsrc_ent[j].last)
-      {
-        snprintf(buf + off, buflen - off, ANUM_FMT, mdata->newsrc_ent[j].first);
-      }
-      else if (mdata->newsrc_ent[j].first < mdata->newsrc_ent[j].last)
-      {
-        snprintf(buf + off, buflen - off, ANUM_FMT "-" ANUM_FMT,
-                 mdata->newsrc_ent[j].first, mdata->newsrc_ent[j].last);
-      }
-      off += strlen(buf + off);
+      continue;
     }
-    buf[off++] = '\n';
+
+    if (newsrc_line_update(mdata))
+      changed = true;
+    len += mutt_str_len(mdata->newsrc_line);
+  }
+
+  /* If nothing has changed and the file is still the one we last read or
+   * wrote, leave it alone.  Keeping its mtime means other instances don't
+   * need to parse it again. */
+  struct stat st = { 0 };
+  if (!changed && adata->newsrc_file && (len == adata->size) &&
+      (stat(adata->newsrc_file, &st) == 0) && (st.st_size == adata->size) &&
+      (st.st_mtime == adata->mtime))
+  {
+    mutt_debug(LL_DEBUG2, "%s is unchanged\n", adata->newsrc_file);
+    return 0;
+  }
+
+  char *buf = mutt_mem_malloc(len + 1);
+  size_t off = 0;
+  for (unsigned int i = 0; i < adata->groups_num; i++)
+  {
+    struct NntpMboxData *mdata = adata->groups_list[i];
+    if (!mdata || !mdata->newsrc_ent || !mdata->newsrc_line)
+      continue;
+
+    const size_t llen = mutt_str_len(mdata->newsrc_line);
+    memcpy(buf + off, mdata->newsrc_line, llen);
+    off += llen;
   }
   buf[off] = '\0';
 
@@ -499,8 +584,6 @@ int nntp_newsrc_update(struct NntpAccountData *adata)
   mutt_debug(LL_DEBUG1, "Updating %s\n", adata->newsrc_file);
   if (adata->newsrc_file && (update_file(adata->newsrc_file, buf) == 0))
   {
-    struct stat st = { 0 };
-
     rc = stat(adata->newsrc_file, &st);
     if (rc == 0)
     {
@@ -677,8 +760,16 @@ int nntp_active_save_cache(struct NntpAccountData *adata)
 
   char file[PATH_MAX] = { 0 };
   cache_expand(file, sizeof(file), &adata->conn->account, ".active");
-  mutt_debug(LL_DEBUG1, "Updating %s\n", file);
-  int rc = update_file(file, buf);
+  int rc = 0;
+  if (file_matches(file, buf))
+  {
+    mutt_debug(LL_DEBUG2, "%s is unchanged\n", file);
+  }
+  else
+  {
+    mutt_debug(LL_DEBUG1, "Updating %s\n", file);
+    rc = update_file(file, buf);
+  }
   FREE(&buf);
   return rc;
 }
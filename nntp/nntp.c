@@ -98,6 +98,7 @@ struct FetchCtx
   unsigned char *messages;
   struct Progress *progress;
   struct HeaderCache *hc;
+  FILE *fp; ///< Scratch file for converting overview lines to headers
 };
 
 /**
@@ -1080,62 +1081,18 @@ static int parse_overview_line(char *line, void *data)
     return 0;
   }
 
-  /* convert overview line to header */
-  FILE *fp = mutt_file_mkstemp();
-  if (!fp)
-    return -1;
-
-  header = mdata->adata->overview_fmt;
-  while (field)
-  {
-    char *b = field;
-
-    if (*header)
-    {
-      if (!strstr(header, ":full") && (fputs(header, fp) == EOF))
-      {
-        mutt_file_fclose(&fp);
-        return -1;
-      }
-      header = strchr(header, '\0') + 1;
-    }
-
-    field = strchr(field, '\t');
-    if (field)
-      *field++ = '\0';
-    if ((fputs(b, fp) == EOF) || (fputc('\n', fp) == EOF))
-    {
-      mutt_file_fclose(&fp);
-      return -1;
-    }
-  }
-  rewind(fp);
-
-  /* allocate memory for headers */
-  mx_alloc_memory(m, m->msg_count);
-
-  /* parse header */
-  m->emails[m->msg_count] = email_new();
-  e = m->emails[m->msg_count];
-  e->env = mutt_rfc822_read_header(fp, e, false, false);
-  e->env->newsgroups = mutt_str_dup(mdata->group);
-  e->received = e->date_sent;
-  mutt_file_fclose(&fp);
-
 #ifdef USE_HCACHE
   if (fc->hc)
   {
     char buf[16] = { 0 };
 
-    /* try to replace with header from cache */
+    /* don't parse the overview of a header we already have */
     snprintf(buf, sizeof(buf), ANUM_FMT, anum);
     struct HCacheEntry hce = hcache_fetch_email(fc->hc, buf, strlen(buf), 0);
     if (hce.email)
     {
       mutt_debug(LL_DEBUG2, "hcache_fetch_email %s\n", buf);
-      email_free(&e);
       e = hce.email;
-      m->emails[m->msg_count] = e;
       e->edata = NULL;
       e->read = false;
       e->old = false;
@@ -1151,17 +1108,67 @@ static int parse_overview_line(char *line, void *data)
         save = false;
       }
     }
+  }
+#endif
+
+  if (!e)
+  {
+    /* convert overview line to header, reusing one temporary file */
+    if (fc->fp)
+    {
+      rewind(fc->fp);
+      if (ftruncate(fileno(fc->fp), 0) != 0)
+        return -1;
+    }
     else
+    {
+      fc->fp = mutt_file_mkstemp();
+      if (!fc->fp)
+        return -1;
+    }
+
+    header = mdata->adata->overview_fmt;
+    while (field)
+    {
+      char *b = field;
+
+      if (*header)
+      {
+        if (!strstr(header, ":full") && (fputs(header, fc->fp) == EOF))
+          return -1;
+        header = strchr(header, '\0') + 1;
+      }
+
+      field = strchr(field, '\t');
+      if (field)
+        *field++ = '\0';
+      if ((fputs(b, fc->fp) == EOF) || (fputc('\n', fc->fp) == EOF))
+        return -1;
+    }
+    rewind(fc->fp);
+
+    /* parse header */
+    e = email_new();
+    e->env = mutt_rfc822_read_header(fc->fp, e, false, false);
+    e->env->newsgroups = mutt_str_dup(mdata->group);
+    e->received = e->date_sent;
+
+#ifdef USE_HCACHE
+    if (fc->hc)
     {
       /* not cached yet, store header */
+      char buf[16] = { 0 };
+      snprintf(buf, sizeof(buf), ANUM_FMT, anum);
       mutt_debug(LL_DEBUG2, "hcache_store_email %s\n", buf);
       hcache_store_email(fc->hc, buf, strlen(buf), e, 0);
     }
-  }
 #endif
+  }
 
   if (save)
   {
+    mx_alloc_memory(m, m->msg_count);
+    m->emails[m->msg_count] = e;
     e->index = m->msg_count++;
     e->read = false;
     e->old = false;
@@ -1191,6 +1198,35 @@ static int parse_overview_line(char *line, void *data)
   return 0;
 }
 
+/**
+ * fetch_overview - Fetch the overview of a range of articles
+ * @param m     Mailbox
+ * @param fc    Fetch context
+ * @param first Number of first article
+ * @param last  Number of last article
+ * @retval  0 Success
+ * @retval  1 Bad response
+ * @retval -1 Connection lost
+ * @retval -2 Error parsing the overview
+ *
+ * The headers are stored in the header cache as they arrive, so an
+ * interrupted fetch doesn't need to be repeated.
+ */
+static int fetch_overview(struct Mailbox *m, struct FetchCtx *fc, anum_t first, anum_t last)
+{
+  struct NntpMboxData *mdata = m->mdata;
+  char buf[1024] = { 0 };
+
+  char *cmd = mdata->adata->hasOVER ? "OVER" : "XOVER";
+  snprintf(buf, sizeof(buf), "%s " ANUM_FMT "-" ANUM_FMT "\r\n", cmd, first, last);
+  int rc = nntp_fetch_lines(mdata, buf, sizeof(buf), NULL, parse_overview_line, fc);
+  if (rc > 0)
+  {
+    mutt_error("%s: %s", cmd, buf);
+  }
+  return rc;
+}
+
 /**
  * nntp_fetch_headers - Fetch headers
  * @param m       Mailbox
@@ -1213,6 +1249,7 @@ static int nntp_fetch_headers(struct Mailbox *m, void *hc, anum_t first, anum_t
   int rc = 0;
   anum_t current;
   anum_t first_over = first;
+  anum_t over_begin = 0;
 
   /* if empty group or nothing to do */
   if (!last || (first > last))
@@ -1304,6 +1341,19 @@ static int nntp_fetch_headers(struct Mailbox *m, void *hc, anum_t first, anum_t
     struct HCacheEntry hce = hcache_fetch_email(fc.hc, buf, strlen(buf), 0);
     if (hce.email)
     {
+      /* fetch the overview of the uncached articles before this one */
+      if (over_begin != 0)
+      {
+        rc = fetch_overview(m, &fc, over_begin, current - 1);
+        over_begin = 0;
+        if (rc != 0)
+        {
+          email_free(&hce.email);
+          break;
+        }
+        mx_alloc_memory(m, m->msg_count);
+      }
+
       mutt_debug(LL_DEBUG2, "hcache_fetch_email %s\n", buf);
       e = hce.email;
       m->emails[m->msg_count] = e;
@@ -1333,11 +1383,10 @@ static int nntp_fetch_headers(struct Mailbox *m, void *hc, anum_t first, anum_t
     }
     else if (mdata->adata->hasOVER || mdata->adata->hasXOVER)
     {
-      /* fallback to fetch overview */
-      if (c_nntp_listgroup && mdata->adata->hasLISTGROUP)
-        break;
-      else
-        continue;
+      /* fallback to fetch overview, one range of uncached articles at a time */
+      if (c_nntp_listgroup && mdata->adata->hasLISTGROUP && (over_begin == 0))
+        over_begin = current;
+      continue;
     }
     else
     {
@@ -1409,19 +1458,14 @@ static int nntp_fetch_headers(struct Mailbox *m, void *hc, anum_t first, anum_t
 
   if (!c_nntp_listgroup || !mdata->adata->hasLISTGROUP)
     current = first_over;
+  else if (over_begin != 0)
+    current = over_begin;
 
   /* fetch overview information */
   if ((current <= last) && (rc == 0) && !mdata->deleted)
-  {
-    char *cmd = mdata->adata->hasOVER ? "OVER" : "XOVER";
-    snprintf(buf, sizeof(buf), "%s " ANUM_FMT "-" ANUM_FMT "\r\n", cmd, current, last);
-    rc = nntp_fetch_lines(mdata, buf, sizeof(buf), NULL, parse_overview_line, &fc);
-    if (rc > 0)
-    {
-      mutt_error("%s: %s", cmd, buf);
-    }
-  }
+    rc = fetch_overview(m, &fc, current, last);
 
+  mutt_file_fclose(&fc.fp);
   FREE(&fc.messages);
   progress_free(&fc.progress);
   if (rc != 0)
@@ -510,6 +510,7 @@ static int update_email_tags(struct Email *e, notmuch_message_t *msg)
 
   /* new version */
   driver_tags_replace(&e->tags, buf_string(new_tags));
+  e->changes++;
   buf_reset(new_tags);
 
   driver_tags_get_transformed(&e->tags, new_tags);
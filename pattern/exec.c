@@ -58,6 +58,9 @@
 #include <sys/stat.h>
 #endif
 
+/// Cached value of $thorough_search
+static struct ConfigHandle CachedThoroughSearch = CONFIG_HANDLE("thorough_search");
+
 static bool pattern_exec(struct Pattern *pat, PatternExecFlags flags,
                          struct Mailbox *m, struct Email *e,
                          struct Message *msg, struct PatternCache *cache);
@@ -127,7 +130,7 @@ static bool msg_search(struct Pattern *pat, struct Email *e, struct Message *msg
 
   const bool needs_head = (pat->op == MUTT_PAT_HEADER) || (pat->op == MUTT_PAT_WHOLE_MSG);
   const bool needs_body = (pat->op == MUTT_PAT_BODY) || (pat->op == MUTT_PAT_WHOLE_MSG);
-  const bool c_thorough_search = cs_subset_bool(NeoMutt->sub, "thorough_search");
+  const bool c_thorough_search = cc_bool(&CachedThoroughSearch);
   if (c_thorough_search)
   {
     /* decode the header / body */
@@ -1132,6 +1135,10 @@ static bool pattern_exec(struct Pattern *pat, PatternExecFlags flags,
 bool mutt_pattern_exec(struct Pattern *pat, PatternExecFlags flags,
                        struct Mailbox *m, struct Email *e, struct PatternCache *cache)
 {
+  /* IMAP search has already evaluated the entire pattern */
+  if (pat->server_eval && m && (m->type == MUTT_IMAP))
+    return e->matched;
+
   const bool needs_msg = pattern_needs_msg(m, pat);
   struct Message *msg = needs_msg ? mx_msg_open(m, e) : NULL;
   if (needs_msg && !msg)
@@ -85,6 +85,7 @@ struct Pattern
   bool dynamic      : 1;         ///< Evaluate date ranges at run time
   bool sendmode     : 1;         ///< Evaluate searches in send-mode
   bool is_multi     : 1;         ///< Multiple case (only for ~I pattern now)
+  bool server_eval  : 1;         ///< Whole pattern was evaluated by an IMAP SEARCH
   long min;                      ///< Minimum for range checks
   long max;                      ///< Maximum for range checks
   struct PatternList *child;     ///< Arguments to logical operation
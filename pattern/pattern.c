@@ -598,6 +598,10 @@ int mutt_search_command(struct MailboxView *mv, struct Menu *menu, int cur,
 
   mutt_error(_("Not found"));
 done:
+  /* The server's answer doesn't cover mail that arrives later, so later
+   * searches must evaluate the non-text parts of the pattern locally */
+  if (state->pattern)
+    SLIST_FIRST(state->pattern)->server_eval = false;
   progress_free(&progress);
   return rc;
 }
@@ -169,6 +169,10 @@ static int fetch_capa(const char *line, void *data)
   {
     adata->cmd_top = 1;
   }
+  else if (mutt_istr_startswith(line, "PIPELINING"))
+  {
+    adata->cmd_pipelining = true;
+  }
 
   return 0;
 }
@@ -216,6 +220,7 @@ static int pop_capabilities(struct PopAccountData *adata, int mode)
     adata->cmd_user = 0;
     adata->cmd_uidl = 0;
     adata->cmd_top = 0;
+    adata->cmd_pipelining = false;
     adata->resp_codes = false;
     adata->expire = true;
     adata->login_delay = 0;
@@ -479,7 +484,25 @@ int pop_query_d(struct PopAccountData *adata, char *buf, size_t buflen, char *ms
   char *c = strpbrk(buf, " \r\n");
   if (c)
     *c = '\0';
-  snprintf(adata->err_msg, sizeof(adata->err_msg), "%s: ", buf);
+
+  return pop_read_response(adata, buf, buf, buflen);
+}
+
+/**
+ * pop_read_response - Read the answer to a command that has been sent
+ * @param adata  POP Account data
+ * @param cmd    Name of the command, for error messages
+ * @param buf    Buffer for the answer
+ * @param buflen Buffer length
+ * @retval  0 Successful
+ * @retval -1 Connection lost
+ * @retval -2 Invalid command or execution error
+ *
+ * @note cmd and buf may be the same buffer
+ */
+int pop_read_response(struct PopAccountData *adata, const char *cmd, char *buf, size_t buflen)
+{
+  snprintf(adata->err_msg, sizeof(adata->err_msg), "%s: ", cmd);
 
   if (mutt_socket_readln_d(buf, buflen, adata->conn, MUTT_SOCK_LOG_FULL) < 0)
   {
@@ -512,14 +535,35 @@ int pop_fetch_data(struct PopAccountData *adata, const char *query,
                    struct Progress *progress, pop_fetch_t callback, void *data)
 {
   char buf[1024] = { 0 };
-  long pos = 0;
-  size_t lenbuf = 0;
 
   mutt_str_copy(buf, query, sizeof(buf));
   int rc = pop_query(adata, buf, sizeof(buf));
   if (rc < 0)
     return rc;
 
+  return pop_read_data(adata, progress, callback, data);
+}
+
+/**
+ * pop_read_data - Read the lines of a multi-line answer
+ * @param adata    POP Account data
+ * @param progress Progress bar
+ * @param callback Function called for each line read
+ * @param data     Data to pass to the callback
+ * @retval  0 Successful
+ * @retval -1 Connection lost
+ * @retval -3 Error in callback(*line, *data)
+ *
+ * The status line of the answer must already have been read.
+ */
+int pop_read_data(struct PopAccountData *adata, struct Progress *progress,
+                  pop_fetch_t callback, void *data)
+{
+  char buf[1024] = { 0 };
+  long pos = 0;
+  size_t lenbuf = 0;
+  int rc = 0;
+
   char *inbuf = mutt_mem_malloc(sizeof(buf));
 
   while (true)
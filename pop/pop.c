@@ -111,12 +111,13 @@ static int fetch_message(const char *line, void *data)
  * pop_read_header - Read header
  * @param adata POP Account data
  * @param e     Email
+ * @param sent  The LIST and TOP commands have already been sent
  * @retval  0 Success
  * @retval -1 Connection lost
  * @retval -2 Invalid command or execution error
  * @retval -3 Error writing to tempfile
  */
-static int pop_read_header(struct PopAccountData *adata, struct Email *e)
+static int pop_read_header(struct PopAccountData *adata, struct Email *e, bool sent)
 {
   FILE *fp = mutt_file_mkstemp();
   if (!fp)
@@ -131,14 +132,31 @@ static int pop_read_header(struct PopAccountData *adata, struct Email *e)
 
   struct PopEmailData *edata = pop_edata_get(e);
 
-  snprintf(buf, sizeof(buf), "LIST %d\r\n", edata->refno);
-  int rc = pop_query(adata, buf, sizeof(buf));
+  int rc;
+  if (sent)
+  {
+    rc = pop_read_response(adata, "LIST", buf, sizeof(buf));
+  }
+  else
+  {
+    snprintf(buf, sizeof(buf), "LIST %d\r\n", edata->refno);
+    rc = pop_query(adata, buf, sizeof(buf));
+  }
   if (rc == 0)
   {
     sscanf(buf, "+OK %d %zu", &index, &length);
 
-    snprintf(buf, sizeof(buf), "TOP %d 0\r\n", edata->refno);
-    rc = pop_fetch_data(adata, buf, NULL, fetch_message, fp);
+    if (sent)
+    {
+      rc = pop_read_response(adata, "TOP", buf, sizeof(buf));
+      if (rc == 0)
+        rc = pop_read_data(adata, NULL, fetch_message, fp);
+    }
+    else
+    {
+      snprintf(buf, sizeof(buf), "TOP %d 0\r\n", edata->refno);
+      rc = pop_fetch_data(adata, buf, NULL, fetch_message, fp);
+    }
 
     if (adata->cmd_top == 2)
     {
@@ -192,6 +210,67 @@ static int pop_read_header(struct PopAccountData *adata, struct Email *e)
   return rc;
 }
 
+/**
+ * pop_read_headers - Read the headers of several emails
+ * @param adata    POP Account data
+ * @param emails   Emails to read
+ * @param cached   Which emails already have a header, from the cache
+ * @param num      Number of emails
+ * @param progress Progress bar
+ * @retval  0 Success
+ * @retval <0 Error, see pop_read_header()
+ *
+ * If the server supports PIPELINING, the commands for a batch of emails are
+ * sent together, rather than waiting a round trip for each email.
+ */
+static int pop_read_headers(struct PopAccountData *adata, struct Email **emails,
+                            const bool *cached, int num, struct Progress *progress)
+{
+  struct Buffer *cmds = buf_pool_get();
+  int sent = 0;
+  int rc = 0;
+
+  for (int i = 0; (i < num) && (rc == 0); i++)
+  {
+    progress_update(progress, i + 1, -1);
+    if (cached[i])
+      continue;
+
+    if (adata->cmd_pipelining && (i >= sent))
+    {
+      buf_reset(cmds);
+      for (int batch = 0; (sent < num) && (batch < POP_PIPELINE_DEPTH); sent++)
+      {
+        if (cached[sent] || (sent < i))
+          continue;
+        const int refno = pop_edata_get(emails[sent])->refno;
+        buf_add_printf(cmds, "LIST %d\r\nTOP %d 0\r\n", refno, refno);
+        batch++;
+      }
+
+      if ((adata->status != POP_CONNECTED) ||
+          (mutt_socket_send_d(adata->conn, buf_string(cmds), MUTT_SOCK_LOG_FULL) < 0))
+      {
+        adata->status = POP_DISCONNECTED;
+        rc = -1;
+        break;
+      }
+    }
+
+    rc = pop_read_header(adata, emails[i], adata->cmd_pipelining);
+  }
+
+  /* The answers to the rest of the pipeline can't be matched up any more */
+  if ((rc < 0) && adata->cmd_pipelining && (adata->status == POP_CONNECTED))
+  {
+    mutt_socket_close(adata->conn);
+    adata->status = POP_DISCONNECTED;
+  }
+
+  buf_pool_release(&cmds);
+  return rc;
+}
+
 /**
  * fetch_uidl - Parse UIDL response - Implements ::pop_fetch_t - @ingroup pop_fetch_api
  * @param line String to parse
@@ -391,12 +470,12 @@ static int pop_fetch_headers(struct Mailbox *m)
                  deleted);
     }
 
-    bool hcached = false;
+    /* look for the new headers in the cache */
+    bool *cached = mutt_mem_calloc(new_count - old_count + 1, sizeof(bool));
+#ifdef USE_HCACHE
     for (i = old_count; i < new_count; i++)
     {
-      progress_update(progress, i + 1 - old_count, -1);
       struct PopEmailData *edata = pop_edata_get(m->emails[i]);
-#ifdef USE_HCACHE
       struct HCacheEntry hce = hcache_fetch_email(hc, edata->uid, strlen(edata->uid), 0);
       if (hce.email)
       {
@@ -418,13 +497,28 @@ static int pop_fetch_headers(struct Mailbox *m)
         /* Reattach the private data */
         m->emails[i]->edata = edata;
         m->emails[i]->edata_free = pop_edata_free;
-        rc = 0;
-        hcached = true;
+        cached[i - old_count] = true;
       }
-      else
+    }
 #endif
-          if ((rc = pop_read_header(adata, m->emails[i])) < 0)
+
+    /* fetch the rest from the server */
+    rc = pop_read_headers(adata, m->emails + old_count, cached,
+                          new_count - old_count, progress);
+
+    bool hcached = false;
+    for (i = old_count; i < new_count; i++)
+    {
+      struct PopEmailData *edata = pop_edata_get(m->emails[i]);
+      if (cached[i - old_count])
+      {
+        hcached = true;
+      }
+      else if (!m->emails[i]->env)
+      {
+        /* the header couldn't be read */
         break;
+      }
 #ifdef USE_HCACHE
       else
       {
@@ -461,6 +555,7 @@ static int pop_fetch_headers(struct Mailbox *m)
 
       m->msg_count++;
     }
+    FREE(&cached);
   }
   progress_free(&progress);
 
@@ -852,6 +947,44 @@ static enum MxStatus pop_mbox_check(struct Mailbox *m)
   return MX_STATUS_OK;
 }
 
+/**
+ * pop_send_deletes - Send a batch of DELE commands
+ * @param[in]  m     Mailbox
+ * @param[in]  first Index of the first Email to delete
+ * @param[out] next  Index of the first Email after the batch
+ * @retval  0 Success
+ * @retval -1 Connection lost
+ */
+static int pop_send_deletes(struct Mailbox *m, int first, int *next)
+{
+  struct PopAccountData *adata = pop_adata_get(m);
+  if (adata->status != POP_CONNECTED)
+    return -1;
+
+  struct Buffer *cmds = buf_pool_get();
+  int i = first;
+  for (int batch = 0; (i < m->msg_count) && (batch < POP_PIPELINE_DEPTH); i++)
+  {
+    struct PopEmailData *edata = pop_edata_get(m->emails[i]);
+    if (m->emails[i]->deleted && (edata->refno != -1))
+    {
+      buf_add_printf(cmds, "DELE %d\r\n", edata->refno);
+      batch++;
+    }
+  }
+  *next = i;
+
+  int rc = 0;
+  if (mutt_socket_send_d(adata->conn, buf_string(cmds), MUTT_SOCK_LOG_FULL) < 0)
+  {
+    adata->status = POP_DISCONNECTED;
+    rc = -1;
+  }
+
+  buf_pool_release(&cmds);
+  return rc;
+}
+
 /**
  * pop_mbox_sync - Save changes to the Mailbox - Implements MxOps::mbox_sync() - @ingroup mx_mbox_sync
  *
@@ -859,7 +992,7 @@ static enum MxStatus pop_mbox_check(struct Mailbox *m)
  */
 static enum MxStatus pop_mbox_sync(struct Mailbox *m)
 {
-  int i, j, rc = 0;
+  int i, j, sent, rc = 0;
   char buf[1024] = { 0 };
   struct PopAccountData *adata = pop_adata_get(m);
 #ifdef USE_HCACHE
@@ -891,15 +1024,26 @@ static enum MxStatus pop_mbox_sync(struct Mailbox *m)
       progress_set_message(progress, _("Marking messages deleted..."));
     }
 
-    for (i = 0, j = 0, rc = 0; (rc == 0) && (i < m->msg_count); i++)
+    for (i = 0, j = 0, sent = 0, rc = 0; (rc == 0) && (i < m->msg_count); i++)
     {
       struct PopEmailData *edata = pop_edata_get(m->emails[i]);
       if (m->emails[i]->deleted && (edata->refno != -1))
       {
         j++;
         progress_update(progress, j, -1);
-        snprintf(buf, sizeof(buf), "DELE %d\r\n", edata->refno);
-        rc = pop_query(adata, buf, sizeof(buf));
+        if (adata->cmd_pipelining)
+        {
+          /* send a batch of DELEs, then read the answers one by one */
+          if (i >= sent)
+            rc = pop_send_deletes(m, i, &sent);
+          if (rc == 0)
+            rc = pop_read_response(adata, "DELE", buf, sizeof(buf));
+        }
+        else
+        {
+          snprintf(buf, sizeof(buf), "DELE %d\r\n", edata->refno);
+          rc = pop_query(adata, buf, sizeof(buf));
+        }
         if (rc == 0)
         {
           mutt_bcache_del(adata->bcache, cache_id(edata->uid));
@@ -922,6 +1066,13 @@ static enum MxStatus pop_mbox_sync(struct Mailbox *m)
     hcache_close(&hc);
 #endif
 
+    /* The answers to the rest of the pipeline can't be matched up any more */
+    if ((rc < 0) && adata->cmd_pipelining && (adata->status == POP_CONNECTED))
+    {
+      mutt_socket_close(adata->conn);
+      adata->status = POP_DISCONNECTED;
+    }
+
     if (rc == 0)
     {
       mutt_str_copy(buf, "QUIT\r\n", sizeof(buf));
@@ -41,6 +41,9 @@ struct Progress;
 /* maximal length of the server response (RFC1939) */
 #define POP_CMD_RESPONSE 512
 
+/* number of commands sent at once to a server that supports PIPELINING */
+#define POP_PIPELINE_DEPTH 50
+
 /**
  * enum PopStatus - POP server responses
  */
@@ -113,6 +116,8 @@ int pop_parse_path(const char *path, struct ConnAccount *acct);
 int pop_connect(struct PopAccountData *adata);
 int pop_open_connection(struct PopAccountData *adata);
 int pop_query_d(struct PopAccountData *adata, char *buf, size_t buflen, char *msg);
+int pop_read_response(struct PopAccountData *adata, const char *cmd, char *buf, size_t buflen);
+int pop_read_data(struct PopAccountData *adata, struct Progress *progress, pop_fetch_t callback, void *data);
 int pop_fetch_data(struct PopAccountData *adata, const char *query,
                    struct Progress *progress, pop_fetch_t callback, void *data);
 int pop_reconnect(struct Mailbox *m);
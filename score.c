@@ -59,6 +59,17 @@ struct Score
 
 /// Linked list of email scoring rules
 static struct Score *ScoreList = NULL;
+/// Last rule in #ScoreList
+static struct Score *ScoreListTail = NULL;
+/// Hash Table of scoring rules (pattern string -> Score)
+static struct HashTable *ScoreHash = NULL;
+
+/// Cached value of $score_threshold_delete
+static struct ConfigHandle CachedScoreThresholdDelete = CONFIG_HANDLE("score_threshold_delete");
+/// Cached value of $score_threshold_flag
+static struct ConfigHandle CachedScoreThresholdFlag = CONFIG_HANDLE("score_threshold_flag");
+/// Cached value of $score_threshold_read
+static struct ConfigHandle CachedScoreThresholdRead = CONFIG_HANDLE("score_threshold_read");
 
 /**
  * mutt_check_rescore - Do the emails need to have their scores recalculated?
@@ -90,8 +101,10 @@ void mutt_check_rescore(struct Mailbox *m)
 enum CommandResult mutt_parse_score(struct Buffer *buf, struct Buffer *s,
                                     intptr_t data, struct Buffer *err)
 {
-  struct Score *ptr = NULL, *last = NULL;
+  struct Score *ptr = NULL;
   char *pattern = NULL, *pc = NULL;
+  bool exact = false;
+  int val = 0;
 
   parse_extract_token(buf, s, TOKEN_NO_FLAGS);
   if (!MoreArgs(s))
@@ -108,18 +121,32 @@ enum CommandResult mutt_parse_score(struct Buffer *buf, struct Buffer *s,
     return MUTT_CMD_WARNING;
   }
 
+  pc = buf->data;
+  if (*pc == '=')
+  {
+    exact = true;
+    pc++;
+  }
+  if (!mutt_str_atoi_full(pc, &val))
+  {
+    FREE(&pattern);
+    buf_strcpy(err, _("Error: score: invalid number"));
+    return MUTT_CMD_ERROR;
+  }
+
   /* look for an existing entry and update the value, else add it to the end
    * of the list */
-  for (ptr = ScoreList, last = NULL; ptr; last = ptr, ptr = ptr->next)
-    if (mutt_str_equal(pattern, ptr->str))
-      break;
-
+  ptr = mutt_hash_find(ScoreHash, pattern);
   if (ptr)
   {
     /* 'buf' arg was cleared and 'pattern' holds the only reference;
      * as here 'ptr' != NULL -> update the value only in which case
      * ptr->str already has the string, so pattern should be freed.  */
     FREE(&pattern);
+
+    /* Re-reading an unchanged rule doesn't affect any scores */
+    if ((ptr->val == val) && (ptr->exact || !exact))
+      return MUTT_CMD_SUCCESS;
   }
   else
   {
@@ -132,25 +159,21 @@ enum CommandResult mutt_parse_score(struct Buffer *buf, struct Buffer *s,
       return MUTT_CMD_ERROR;
     }
     ptr = mutt_mem_calloc(1, sizeof(struct Score));
-    if (last)
-      last->next = ptr;
+    if (ScoreListTail)
+      ScoreListTail->next = ptr;
     else
       ScoreList = ptr;
+    ScoreListTail = ptr;
     ptr->pat = pat;
     ptr->str = pattern;
+
+    if (!ScoreHash)
+      ScoreHash = mutt_hash_new(127, MUTT_HASH_NO_FLAGS);
+    mutt_hash_insert(ScoreHash, ptr->str, ptr);
   }
-  pc = buf->data;
-  if (*pc == '=')
-  {
+  if (exact)
     ptr->exact = true;
-    pc++;
-  }
-  if (!mutt_str_atoi_full(pc, &ptr->val))
-  {
-    FREE(&pattern);
-    buf_strcpy(err, _("Error: score: invalid number"));
-    return MUTT_CMD_ERROR;
-  }
+  ptr->val = val;
   OptNeedRescore = true;
   return MUTT_CMD_SUCCESS;
 }
@@ -182,9 +205,9 @@ void mutt_score_message(struct Mailbox *m, struct Email *e, bool upd_mbox)
   if (e->score < 0)
     e->score = 0;
 
-  const short c_score_threshold_delete = cs_subset_number(NeoMutt->sub, "score_threshold_delete");
-  const short c_score_threshold_flag = cs_subset_number(NeoMutt->sub, "score_threshold_flag");
-  const short c_score_threshold_read = cs_subset_number(NeoMutt->sub, "score_threshold_read");
+  const short c_score_threshold_delete = cc_number(&CachedScoreThresholdDelete);
+  const short c_score_threshold_flag = cc_number(&CachedScoreThresholdFlag);
+  const short c_score_threshold_read = cc_number(&CachedScoreThresholdRead);
 
   if (e->score <= c_score_threshold_delete)
     mutt_set_flag(m, e, MUTT_DELETE, true, upd_mbox);
@@ -201,24 +224,30 @@ enum CommandResult mutt_parse_unscore(struct Buffer *buf, struct Buffer *s,
                                       intptr_t data, struct Buffer *err)
 {
   struct Score *tmp = NULL, *last = NULL;
+  bool changed = false;
 
   while (MoreArgs(s))
   {
     parse_extract_token(buf, s, TOKEN_NO_FLAGS);
     if (mutt_str_equal("*", buf->data))
     {
+      if (ScoreList)
+        changed = true;
       for (tmp = ScoreList; tmp;)
       {
         last = tmp;
         tmp = tmp->next;
         mutt_pattern_free(&last->pat);
+        FREE(&last->str);
         FREE(&last);
       }
       ScoreList = NULL;
+      ScoreListTail = NULL;
+      mutt_hash_free(&ScoreHash);
     }
     else
     {
-      for (tmp = ScoreList; tmp; last = tmp, tmp = tmp->next)
+      for (tmp = ScoreList, last = NULL; tmp; last = tmp, tmp = tmp->next)
       {
         if (mutt_str_equal(buf->data, tmp->str))
         {
@@ -226,14 +255,20 @@ enum CommandResult mutt_parse_unscore(struct Buffer *buf, struct Buffer *s,
             last->next = tmp->next;
           else
             ScoreList = tmp->next;
+          if (ScoreListTail == tmp)
+            ScoreListTail = last;
+          mutt_hash_delete(ScoreHash, tmp->str, tmp);
           mutt_pattern_free(&tmp->pat);
+          FREE(&tmp->str);
           FREE(&tmp);
+          changed = true;
           /* there should only be one score per pattern, so we can stop here */
           break;
         }
       }
     }
   }
-  OptNeedRescore = true;
+  if (changed)
+    OptNeedRescore = true;
   return MUTT_CMD_SUCCESS;
 }
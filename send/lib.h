@@ -35,6 +35,7 @@
  * | send/sendlib.c   | @subpage send_sendlib   |
  * | send/sendmail.c  | @subpage send_sendmail  |
  * | send/smtp.c      | @subpage send_smtp      |
+ * | send/smtp_body.c | @subpage send_smtp_body |
  */
 
 #ifndef MUTT_SEND_LIB_H
@@ -72,6 +72,9 @@
 #define SMTP_PORT 25
 #define SMTPS_PORT 465
 
+/* the message body is sent in pieces of about this size */
+#define SMTP_CHUNK_SIZE 65536
+
 #define SMTP_AUTH_SUCCESS 0
 #define SMTP_AUTH_UNAVAIL 1
 #define SMTP_AUTH_FAIL -1
@@ -87,7 +90,9 @@ typedef uint8_t SmtpCapFlags;          ///< Flags, e.g. #SMTP_CAP_STARTTLS
 #define SMTP_CAP_DSN          (1 << 2) ///< Server supports Delivery Status Notification
 #define SMTP_CAP_EIGHTBITMIME (1 << 3) ///< Server supports 8-bit MIME content
 #define SMTP_CAP_SMTPUTF8     (1 << 4) ///< Server accepts UTF-8 strings
-#define SMTP_CAP_ALL         ((1 << 5) - 1)
+#define SMTP_CAP_PIPELINING   (1 << 5) ///< Server accepts pipelined commands
+#define SMTP_CAP_CHUNKING     (1 << 6) ///< Server supports BDAT command
+#define SMTP_CAP_ALL         ((1 << 7) - 1)
 // clang-format on
 
 /**
@@ -176,6 +181,14 @@ static int smtp_get_resp(struct SmtpAccountData *adata)
     {
       adata->capabilities |= SMTP_CAP_SMTPUTF8;
     }
+    else if (mutt_istr_startswith(s, "PIPELINING"))
+    {
+      adata->capabilities |= SMTP_CAP_PIPELINING;
+    }
+    else if (mutt_istr_startswith(s, "CHUNKING"))
+    {
+      adata->capabilities |= SMTP_CAP_CHUNKING;
+    }
 
     if (!valid_smtp_code(buf, &n))
       return SMTP_ERR_CODE;
@@ -193,15 +206,18 @@ static int smtp_get_resp(struct SmtpAccountData *adata)
  * smtp_rcpt_to - Set the recipient to an Address
  * @param adata SMTP Account data
  * @param al    AddressList to use
- * @retval  0 Success
- * @retval <0 Error, e.g. #SMTP_ERR_WRITE
+ * @param queue If not NULL, add the commands to this, rather than sending them
+ * @retval >=0 Success, number of commands queued
+ * @retval  <0 Error, e.g. #SMTP_ERR_WRITE
  */
-static int smtp_rcpt_to(struct SmtpAccountData *adata, const struct AddressList *al)
+static int smtp_rcpt_to(struct SmtpAccountData *adata,
+                        const struct AddressList *al, struct Buffer *queue)
 {
   if (!al)
     return 0;
 
   const char *const c_dsn_notify = cs_subset_string(adata->sub, "dsn_notify");
+  int num = 0;
 
   struct Address *a = NULL;
   TAILQ_FOREACH(a, al, entries)
@@ -221,6 +237,12 @@ static int smtp_rcpt_to(struct SmtpAccountData *adata, const struct AddressList
     {
       snprintf(buf, sizeof(buf), "RCPT TO:<%s>\r\n", buf_string(a->mailbox));
     }
+    if (queue)
+    {
+      buf_addstr(queue, buf);
+      num++;
+      continue;
+    }
     if (mutt_socket_send(adata->conn, buf) == -1)
       return SMTP_ERR_WRITE;
     int rc = smtp_get_resp(adata);
@@ -228,6 +250,87 @@ static int smtp_rcpt_to(struct SmtpAccountData *adata, const struct AddressList
       return rc;
   }
 
+  return num;
+}
+
+/**
+ * smtp_envelope_pipelined - Send the envelope without waiting for each answer
+ * @param adata SMTP Account data
+ * @param cmds  MAIL FROM command
+ * @param to    To recipients
+ * @param cc    Cc recipients
+ * @param bcc   Bcc recipients
+ * @retval  0 Success
+ * @retval <0 Error, e.g. #SMTP_ERR_WRITE
+ *
+ * The server supports PIPELINING (RFC2920), so the MAIL FROM and all the
+ * RCPT TO commands are sent together, then the answers are checked.
+ */
+static int smtp_envelope_pipelined(struct SmtpAccountData *adata, struct Buffer *cmds,
+                                   const struct AddressList *to, const struct AddressList *cc,
+                                   const struct AddressList *bcc)
+{
+  const struct AddressList *lists[] = { to, cc, bcc };
+  int num = 1;
+
+  for (size_t i = 0; i < mutt_array_size(lists); i++)
+    num += smtp_rcpt_to(adata, lists[i], cmds);
+
+  if (mutt_socket_send(adata->conn, buf_string(cmds)) == -1)
+    return SMTP_ERR_WRITE;
+
+  for (; num > 0; num--)
+  {
+    int rc = smtp_get_resp(adata);
+    if (rc != 0)
+      return rc;
+  }
+
+  return 0;
+}
+
+/**
+ * smtp_send_chunk - Send a piece of the message body
+ * @param adata   SMTP Account data
+ * @param chunk   Data to send
+ * @param last    This is the end of the message
+ * @param pending Number of BDAT answers still to be read
+ * @retval  0 Success
+ * @retval <0 Error, e.g. #SMTP_ERR_WRITE
+ *
+ * If the server supports CHUNKING (RFC3030), each piece is sent with BDAT.
+ * If it supports PIPELINING, too, then the answers are only read at the end.
+ */
+static int smtp_send_chunk(struct SmtpAccountData *adata, struct Buffer *chunk,
+                           bool last, int *pending)
+{
+  if (adata->capabilities & SMTP_CAP_CHUNKING)
+  {
+    char cmd[64] = { 0 };
+    snprintf(cmd, sizeof(cmd), "BDAT %zu%s\r\n", buf_len(chunk), last ? " LAST" : "");
+    if (mutt_socket_send(adata->conn, cmd) == -1)
+      return SMTP_ERR_WRITE;
+    (*pending)++;
+  }
+
+  if ((buf_len(chunk) > 0) &&
+      (mutt_socket_write_d(adata->conn, buf_string(chunk), buf_len(chunk),
+                           MUTT_SOCK_LOG_FULL) == -1))
+  {
+    return SMTP_ERR_WRITE;
+  }
+  buf_reset(chunk);
+
+  if (!last && (adata->capabilities & SMTP_CAP_PIPELINING))
+    return 0;
+
+  for (; *pending > 0; (*pending)--)
+  {
+    int rc = smtp_get_resp(adata);
+    if (rc != 0)
+      return rc;
+  }
+
   return 0;
 }
 
@@ -242,9 +345,10 @@ static int smtp_data(struct SmtpAccountData *adata, const char *msgfile)
 {
   char buf[1024] = { 0 };
   struct Progress *progress = NULL;
+  struct Buffer *chunk = NULL;
   int rc = SMTP_ERR_WRITE;
-  int term = 0;
-  size_t buflen = 0;
+  bool bol = true;
+  int pending = 0;
 
   FILE *fp = mutt_file_fopen(msgfile, "r");
   if (!fp)
@@ -262,56 +366,53 @@ static int smtp_data(struct SmtpAccountData *adata, const char *msgfile)
   progress = progress_new(MUTT_PROGRESS_NET, size);
   progress_set_message(progress, _("Sending message..."));
 
-  snprintf(buf, sizeof(buf), "DATA\r\n");
-  if (mutt_socket_send(adata->conn, buf) == -1)
-  {
-    mutt_file_fclose(&fp);
-    goto done;
-  }
-  rc = smtp_get_resp(adata);
-  if (rc != 0)
-  {
-    mutt_file_fclose(&fp);
-    goto done;
-  }
-
-  rc = SMTP_ERR_WRITE;
-  while (fgets(buf, sizeof(buf) - 1, fp))
+  /* BDAT doesn't need the DATA command, or dot-stuffing */
+  const bool chunking = (adata->capabilities & SMTP_CAP_CHUNKING);
+  if (!chunking)
   {
-    buflen = mutt_str_len(buf);
-    term = buflen && buf[buflen - 1] == '\n';
-    if (term && ((buflen == 1) || (buf[buflen - 2] != '\r')))
-      snprintf(buf + buflen - 1, sizeof(buf) - buflen + 1, "\r\n");
-    if (buf[0] == '.')
+    snprintf(buf, sizeof(buf), "DATA\r\n");
+    if (mutt_socket_send(adata->conn, buf) == -1)
     {
-      if (mutt_socket_send_d(adata->conn, ".", MUTT_SOCK_LOG_FULL) == -1)
-      {
-        mutt_file_fclose(&fp);
-        goto done;
-      }
+      mutt_file_fclose(&fp);
+      goto done;
     }
-    if (mutt_socket_send_d(adata->conn, buf, MUTT_SOCK_LOG_FULL) == -1)
+    rc = smtp_get_resp(adata);
+    if (rc != 0)
     {
       mutt_file_fclose(&fp);
       goto done;
     }
-    progress_update(progress, MAX(0, ftell(fp)), -1);
   }
-  if (!term && buflen &&
-      (mutt_socket_send_d(adata->conn, "\r\n", MUTT_SOCK_LOG_FULL) == -1))
+
+  chunk = buf_pool_get();
+  rc = 0;
+  while ((rc == 0) && fgets(buf, sizeof(buf) - 1, fp))
   {
-    mutt_file_fclose(&fp);
-    goto done;
+    smtp_add_data(chunk, buf, sizeof(buf), &bol, !chunking);
+
+    if (buf_len(chunk) >= SMTP_CHUNK_SIZE)
+    {
+      rc = smtp_send_chunk(adata, chunk, false, &pending);
+      progress_update(progress, MAX(0, ftell(fp)), -1);
+    }
   }
   mutt_file_fclose(&fp);
+  if (rc != 0)
+    goto done;
+
+  if (!bol)
+    buf_addstr(chunk, "\r\n");
 
   /* terminate the message body */
-  if (mutt_socket_send(adata->conn, ".\r\n") == -1)
-    goto done;
+  if (!chunking)
+    buf_addstr(chunk, ".\r\n");
 
-  rc = smtp_get_resp(adata);
+  rc = smtp_send_chunk(adata, chunk, true, &pending);
+  if ((rc == 0) && !chunking)
+    rc = smtp_get_resp(adata);
 
 done:
+  buf_pool_release(&chunk);
   progress_free(&progress);
   return rc;
 }
@@ -1163,20 +1264,29 @@ int mutt_smtp_send(const struct AddressList *from, const struct AddressList *to,
       buf_addstr(buf, " SMTPUTF8");
     }
     buf_addstr(buf, "\r\n");
-    if (mutt_socket_send(adata.conn, buf_string(buf)) == -1)
+    if (adata.capabilities & SMTP_CAP_PIPELINING)
     {
-      rc = SMTP_ERR_WRITE;
-      break;
+      rc = smtp_envelope_pipelined(&adata, buf, to, cc, bcc);
+      if (rc != 0)
+        break;
     }
-    rc = smtp_get_resp(&adata);
-    if (rc != 0)
-      break;
-
-    /* send the recipient list */
-    if ((rc = smtp_rcpt_to(&adata, to)) || (rc = smtp_rcpt_to(&adata, cc)) ||
-        (rc = smtp_rcpt_to(&adata, bcc)))
+    else
     {
-      break;
+      if (mutt_socket_send(adata.conn, buf_string(buf)) == -1)
+      {
+        rc = SMTP_ERR_WRITE;
+        break;
+      }
+      rc = smtp_get_resp(&adata);
+      if (rc != 0)
+        break;
+
+      /* send the recipient list */
+      if ((rc = smtp_rcpt_to(&adata, to, NULL)) || (rc = smtp_rcpt_to(&adata, cc, NULL)) ||
+          (rc = smtp_rcpt_to(&adata, bcc, NULL)))
+      {
+        break;
+      }
     }
 
     /* send the message data */
@@ -26,10 +26,13 @@
 
 #include "config.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 struct AddressList;
+struct Buffer;
 struct ConfigSubset;
 
+void smtp_add_data(struct Buffer *chunk, char *data, size_t datalen, bool *bol, bool stuff);
 bool smtp_auth_is_valid(const char *authenticator);
 int mutt_smtp_send(const struct AddressList *from, const struct AddressList *to,
                    const struct AddressList *cc, const struct AddressList *bcc,
@@ -0,0 +1,57 @@
+/**
+ * @file
+ * Prepare an email body for an SMTP server
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page send_smtp_body Prepare an email body for an SMTP server
+ *
+ * Prepare an email body for an SMTP server
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "smtp.h"
+
+/**
+ * smtp_add_data - Add a piece of the message body to a chunk
+ * @param chunk   Buffer for the chunk
+ * @param data    Piece of the body, as read by fgets()
+ * @param datalen Size of the @a data buffer
+ * @param bol     true, if @a data is at the start of a line; updated for the next piece
+ * @param stuff   true, if lines starting with '.' need dot-stuffing
+ *
+ * A line longer than the read buffer arrives in several pieces.  Only the
+ * first of them can be dot-stuffed.  The line ending is converted to CRLF.
+ */
+void smtp_add_data(struct Buffer *chunk, char *data, size_t datalen, bool *bol, bool stuff)
+{
+  const size_t len = mutt_str_len(data);
+  const bool term = (len != 0) && (data[len - 1] == '\n');
+  if (term && ((len == 1) || (data[len - 2] != '\r')))
+    snprintf(data + len - 1, datalen - len + 1, "\r\n");
+  if (stuff && *bol && (data[0] == '.'))
+    buf_addch(chunk, '.');
+  buf_addstr(chunk, data);
+
+  *bol = term;
+}
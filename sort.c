@@ -48,6 +48,9 @@
 #include "mx.h"
 #include "score.h"
 
+/// Cached value of $reverse_alias
+static struct ConfigHandle CachedReverseAlias = CONFIG_HANDLE("reverse_alias");
+
 /**
  * struct EmailCompare - Context for compare_email_shim()
  */
@@ -137,7 +140,7 @@ const char *mutt_get_name(const struct Address *a)
 
   if (a)
   {
-    const bool c_reverse_alias = cs_subset_bool(NeoMutt->sub, "reverse_alias");
+    const bool c_reverse_alias = cc_bool(&CachedReverseAlias);
     if (c_reverse_alias && (ali = alias_reverse_lookup(a)) && ali->personal)
       return buf_string(ali->personal);
     if (a->personal)
@@ -29,6 +29,8 @@
 #include "core/lib.h"
 #include "test_common.h" // IWYU pragma: keep
 
+static struct ConfigHandle CachedMaildirFieldDelimiter = CONFIG_HANDLE("maildir_field_delimiter");
+
 void test_config_cache(void)
 {
   log_line(__func__);
@@ -49,5 +51,14 @@ void test_config_cache(void)
     TEST_CHECK(CSR_RESULT(rc) == CSR_SUCCESS);
   }
 
+  {
+    const char *c_delim = cc_string(&CachedMaildirFieldDelimiter);
+    TEST_CHECK_STR_EQ(c_delim, ":");
+    int rc = cs_subset_str_string_set(sub, "maildir_field_delimiter", ";", NULL);
+    TEST_CHECK(CSR_RESULT(rc) == CSR_SUCCESS);
+    c_delim = cc_string(&CachedMaildirFieldDelimiter);
+    TEST_CHECK_STR_EQ(c_delim, ";");
+  }
+
   log_line(__func__);
 }
@@ -100,6 +100,18 @@ void test_expando_simple_expando_render(void)
 
   TEST_CHECK_STR_EQ(buf_string(buf), expected);
 
+  // The tree has been compiled; rendering again must give the same result
+  TEST_CHECK(root->rdata == render);
+  TEST_CHECK(get_nth_node(root, 1)->text_cols == 3);
+  buf_reset(buf);
+  expando_render(&expando, render, &data, MUTT_FORMAT_NO_FLAGS, buf->dsize, buf);
+  TEST_CHECK_STR_EQ(buf_string(buf), expected);
+
+  // Compiled text is still truncated to fit
+  buf_reset(buf);
+  expando_render(&expando, render, &data, MUTT_FORMAT_NO_FLAGS, 6, buf);
+  TEST_CHECK_STR_EQ(buf_string(buf), "Test -");
+
   node_tree_free(&root);
   buf_pool_release(&buf);
 }
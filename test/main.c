@@ -602,6 +602,9 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_rfc2231_decode_parameters)                            \
   NEOMUTT_TEST_ITEM(test_rfc2231_encode_string)                                \
                                                                                \
+  /* send */                                                                   \
+  NEOMUTT_TEST_ITEM(test_smtp_add_data)                                        \
+                                                                               \
   /* signal */                                                                 \
   NEOMUTT_TEST_ITEM(test_mutt_sig_allow_interrupt)                             \
   NEOMUTT_TEST_ITEM(test_mutt_sig_block)                                       \
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * Test code for smtp_add_data()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "send/smtp.h"
+#include "test_common.h"
+
+/**
+ * add_pieces - Feed some pieces of a message body to smtp_add_data()
+ * @param chunk  Buffer for the result
+ * @param pieces Pieces, as fgets() would return them, NULL terminated
+ * @param stuff  Dot-stuff the lines
+ * @retval bool Is the next piece at the start of a line?
+ */
+static bool add_pieces(struct Buffer *chunk, const char **pieces, bool stuff)
+{
+  char buf[64] = { 0 };
+  bool bol = true;
+
+  for (; *pieces; pieces++)
+  {
+    mutt_str_copy(buf, *pieces, sizeof(buf) - 1);
+    smtp_add_data(chunk, buf, sizeof(buf), &bol, stuff);
+  }
+
+  return bol;
+}
+
+void test_smtp_add_data(void)
+{
+  // void smtp_add_data(struct Buffer *chunk, char *data, size_t datalen, bool *bol, bool stuff);
+
+  struct Buffer *chunk = buf_pool_get();
+
+  {
+    // Line endings are converted to CRLF
+    const char *pieces[] = { "one\n", "two\r\n", "\n", NULL };
+    buf_reset(chunk);
+    TEST_CHECK(add_pieces(chunk, pieces, true));
+    TEST_CHECK_STR_EQ(buf_string(chunk), "one\r\ntwo\r\n\r\n");
+  }
+
+  {
+    // A line starting with a dot is stuffed
+    const char *pieces[] = { ".\n", "..two\n", "a.b\n", NULL };
+    buf_reset(chunk);
+    TEST_CHECK(add_pieces(chunk, pieces, true));
+    TEST_CHECK_STR_EQ(buf_string(chunk), "..\r\n...two\r\na.b\r\n");
+  }
+
+  {
+    // The continuation of a long line is never stuffed
+    const char *pieces[] = { ".start", ".middle", ".end\n", ".next\n", NULL };
+    buf_reset(chunk);
+    TEST_CHECK(add_pieces(chunk, pieces, true));
+    TEST_CHECK_STR_EQ(buf_string(chunk), "..start.middle.end\r\n..next\r\n");
+  }
+
+  {
+    // A body that doesn't end with a newline leaves us mid-line
+    const char *pieces[] = { "one\n", ".two", NULL };
+    buf_reset(chunk);
+    TEST_CHECK(!add_pieces(chunk, pieces, true));
+    TEST_CHECK_STR_EQ(buf_string(chunk), "one\r\n..two");
+  }
+
+  {
+    // BDAT doesn't need stuffing
+    const char *pieces[] = { ".one\n", ".two", ".three\n", NULL };
+    buf_reset(chunk);
+    TEST_CHECK(add_pieces(chunk, pieces, false));
+    TEST_CHECK_STR_EQ(buf_string(chunk), ".one\r\n.two.three\r\n");
+  }
+
+  buf_pool_release(&chunk);
+}